@@ -0,0 +1,46 @@
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#include "process.h"
+
+// 시뮬레이션 없이 주기 태스크 집합의 스케줄 가능성을 판정
+//
+// 태스크 모델: 실행 시간 C는 CPU 버스트에 I/O 시간을 더한 값
+// (I/O로 멈춘 시간도 실행으로 보는 보수적인 모델), 상대 데드라인 D는
+// 첫 작업의 데드라인 - 도착 시각, 주기 T는 period
+// 도착 시각(오프셋)은 무시하고 모든 태스크가 동시에 릴리즈되는 경우를
+// 검사하므로, 오프셋이 있는 집합에서도 판정 결과는 안전한 쪽이다
+
+// 고정 우선순위 배정 방식
+typedef enum {
+    PRIORITY_RATE_MONOTONIC,    // 주기가 짧을수록 높음 (RMS)
+    PRIORITY_DEADLINE_MONOTONIC // 상대 데드라인이 짧을수록 높음 (DM)
+} PriorityAssignment;
+
+// 응답 시간 분석의 태스크별 결과
+typedef struct {
+    int pid;
+    long long wcet;     // C (CPU + I/O)
+    int period;         // T
+    int deadline;       // D (상대 데드라인)
+    long long response; // 최악 응답 시간 (-1: 상한 없음, 과부하)
+    int schedulable;    // response <= deadline
+} TaskResponse;
+
+// 프로세서 요구량 검사(EDF) 결과
+typedef struct {
+    double utilization;
+    int schedulable;
+    long long interval; // 검사한 구간 길이 L
+    long long failure;  // 요구량이 t를 넘는 시점 (-1: 없음)
+    long checkpoints;   // 요구량 h(t)를 계산한 횟수
+} DemandResult;
+
+int response_time_analysis(const Process *tasks, int count,
+                           PriorityAssignment order, TaskResponse *out);
+int processor_demand_test(const Process *tasks, int count, DemandResult *out);
+void print_response_times(const Process *tasks, int count,
+                          PriorityAssignment order);
+int print_schedulability_analysis(const Process *tasks, int count);
+
+#endif
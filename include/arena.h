@@ -0,0 +1,29 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+#define ARENA_MIN_BLOCK_SIZE (64 * 1024) // 새 블록의 최소 크기 (바이트)
+
+typedef struct ArenaBlock ArenaBlock;
+
+// 시뮬레이션 한 번 동안 쓰는 임시 버퍼용 bump 할당기
+// 개별 해제 없이 reset_arena로 한꺼번에 비우고 다음 실행에서 블록을 재사용한다
+//
+// arena 인자가 NULL이면 모든 함수가 일반 malloc/realloc/free로 동작하므로
+// 자료구조는 arena 사용 여부와 상관없이 같은 코드로 메모리를 관리할 수 있다
+typedef struct {
+    ArenaBlock *blocks; // 현재 블록 (이전 블록은 next로 연결)
+    size_t reserved;    // 모든 블록의 크기 합
+    void *last;         // 마지막 할당 (제자리에서 늘릴 수 있음)
+} Arena;
+
+void init_arena(Arena *arena);
+void *arena_alloc(Arena *arena, size_t size);
+void *arena_realloc(Arena *arena, void *ptr, size_t old_size,
+                    size_t new_size);
+void arena_free(Arena *arena, void *ptr);
+void reset_arena(Arena *arena);
+void free_arena(Arena *arena);
+
+#endif
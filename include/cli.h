@@ -0,0 +1,37 @@
+#ifndef CLI_H
+#define CLI_H
+
+#include "config.h"
+#include "engine.h"
+#include "evaluation.h"
+#include "sweep.h"
+#include "workload.h"
+
+#define CLI_DEFAULT_QUANTUM 2
+#define CLI_MAX_POLICIES 9
+
+// 명령행 옵션 (배치 모드)
+typedef struct {
+    const char *workload_path; // 프로세스 설정 파일
+    SchedulingPolicy policies[CLI_MAX_POLICIES]; // 실행할 알고리즘 (지정 순서)
+    int policy_count;
+    int quantum;             // RR 타임 퀀텀
+    int max_time;            // EDF, RMS 시뮬레이션 길이
+    OutputFormat format;     // 비교 지표 출력 형식
+    const char *output_path; // 지표 출력 파일 (NULL: stdout)
+    OutputLevel level;       // 알고리즘별 결과 출력 수준
+    int stream;              // 파일을 읽으면서 시뮬레이션 (전체를 올리지 않음)
+    int worker_threads;      // 시뮬레이션 스레드 수 (0: CPU 코어 수)
+    int steady_state;        // EDF/RMS 하이퍼피리어드 반복 외삽
+    CpuConfig cpu;           // 코어 수와 멀티코어 배정 방식
+    int analyze;             // 시뮬레이션 대신 스케줄 가능성 분석만 출력
+    int sweep;               // 알고리즘 대신 RR 퀀텀 범위를 실행
+    QuantumRange sweep_range; // 실행할 RR 퀀텀 범위
+    const char *convert_path;      // 변환 결과 파일 (NULL: 시뮬레이션 실행)
+    WorkloadFormat convert_format; // 변환할 형식
+} CliOptions;
+
+int parse_cli_options(int argc, char *argv[], CliOptions *options);
+int run_batch(CliOptions *options);
+
+#endif
@@ -1,10 +1,54 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+// 알고리즘 실행 결과 출력 수준
+typedef enum {
+    OUTPUT_FULL,    // 간트차트, 프로세스 표, 성능 요약, I/O 통계 모두 출력
+    OUTPUT_SUMMARY, // 성능 요약만 출력
+    OUTPUT_METRICS  // 출력 없이 지표만 계산
+} OutputLevel;
+
+// 멀티코어에서 프로세스를 코어에 배정하는 방식
+typedef enum {
+    DISPATCH_GLOBAL,     // 모든 코어가 ready queue 하나를 공유
+    DISPATCH_PARTITIONED // 프로세스를 코어 하나에 고정, 코어마다 ready queue
+} DispatchMode;
+
+// partitioned에서 할 일이 없는 코어가 다른 코어의 ready queue에서 가져오는 방식
+typedef enum {
+    STEAL_NONE,     // 가져오지 않음
+    STEAL_HALF,     // 가장 붐비는 큐의 앞쪽 절반
+    STEAL_OLDEST,   // 가장 붐비는 큐에서 가장 오래 기다린 작업 하나
+    STEAL_SHORTEST  // 가장 붐비는 큐에서 남은 CPU 시간이 가장 짧은 작업 하나
+} StealPolicy;
+
+// partitioned EDF/RMS에서 주기 태스크를 코어에 나누는 방식
+// (bin-packing 방식은 이용률이 큰 태스크부터 배정)
+typedef enum {
+    PARTITION_ROUND_ROBIN, // 태스크 번호 순서로 돌아가며
+    PARTITION_FIRST_FIT,   // 받아 주는 첫 코어 (FFD)
+    PARTITION_BEST_FIT,    // 받아 주는 코어 중 이용률이 가장 높은 코어 (BFD)
+    PARTITION_WORST_FIT    // 받아 주는 코어 중 이용률이 가장 낮은 코어 (WFD)
+} PartitionFit;
+
+// 시뮬레이션할 CPU 구성
+typedef struct {
+    int cores;             // 코어 수 (1이면 단일 CPU)
+    DispatchMode dispatch; // 코어가 둘 이상일 때의 배정 방식
+    StealPolicy steal;     // partitioned: 작업 훔치기 방식
+    int switch_cost;       // 코어가 다른 작업으로 바꿔 올릴 때마다 드는 시간
+    int migration_cost;    // 다른 코어로 옮겨진 작업이 실행 전에 쓰는 시간
+    PartitionFit partition; // partitioned EDF/RMS: 태스크를 코어에 나누는 방식
+} CpuConfig;
+
 typedef struct {
     int time_quantum;  // RR 알고리즘의 타임 퀀텀
     char mode;         // 모드 (y: 랜덤, n: 수동, f: 파일 사용)
     int deadline_miss_info_count; // 데드라인 미스 정보 배열 크기
+    int worker_threads; // 비교 분석 시 시뮬레이션 스레드 수 (0: CPU 코어 수)
+    OutputLevel output_level; // 알고리즘별 결과 출력 수준
+    int steady_state; // EDF/RMS: 반복되는 하이퍼피리어드를 찾아 나머지를 외삽
+    CpuConfig cpu;    // 코어 수와 배정 방식
 } Config;
 
 void init_config(Config *config, char mode);
@@ -0,0 +1,112 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "evaluation.h"
+#include "event.h"
+#include "process.h"
+#include "queue.h"
+#include "sched_state.h"
+#include "workload.h"
+
+#define AGING_THRESHOLD 3 // aging 임계값 (ready 상태로 기다린 시간)
+#define STREAM_INITIAL_SLOTS 1024 // 스트리밍 시뮬레이션의 초기 슬롯 수
+#define STEADY_STATE_MAX_PERIODS 16 // 반복을 찾아볼 최대 하이퍼피리어드 수
+
+// 이벤트 기반 엔진에서 지원하는 스케줄링 정책
+typedef enum {
+    POLICY_FCFS,
+    POLICY_SJF_NP,
+    POLICY_SJF_P,
+    POLICY_PRIORITY_NP,
+    POLICY_PRIORITY_P,
+    POLICY_RR,
+    POLICY_PRIORITY_AGING,
+    POLICY_RMS,
+    POLICY_EDF
+} SchedulingPolicy;
+
+// simulate()의 동작 옵션 (OR로 조합)
+typedef enum {
+    SIM_DETAILED = 1 << 0,    // 간트차트와 인스턴스/미스/aging 기록을 남김
+    SIM_STEADY_STATE = 1 << 1 // EDF/RMS: 하이퍼피리어드마다 반복되는 상태를
+                              // 찾으면 나머지 구간은 합계를 외삽
+} SimulationFlag;
+
+// Priority with Aging 실행 중 발생한 우선순위 변경 / 선점 기록
+typedef struct {
+    int time;         // 발생 시각
+    int pid;          // 대상 프로세스
+    int age;          // 변경 시점의 나이
+    int old_priority; // 변경 전 우선순위
+    int new_priority; // 변경 후 우선순위
+    int preemption;   // 1이면 aging으로 인한 선점 기록
+} AgingLogEntry;
+
+// 간트차트, 인스턴스, 미스 기록, aging 기록은 실행에 쓴 SchedState의
+// scratch arena에 있으므로 그 state를 다시 쓰거나 해제하기 전까지 유효
+typedef struct {
+    Arena *arena; // 결과 버퍼를 할당한 arena (NULL이면 일반 힙)
+    GanttChart gantt;
+    int total_time;
+    int idle_time;
+
+    Process *instances; // EDF/RMS 작업 인스턴스 기록 (릴리즈 순서)
+    int instance_count; // 릴리즈된 인스턴스 수 (기록을 남기지 않아도 셈)
+    int instance_capacity;
+
+    // 프로세스별 결과 (EDF/RMS는 instances와 같은 순서의 인스턴스별 결과)
+    // 실행에 쓴 SchedState의 배열이므로 그 state를 다시 쓰거나 해제하기 전까지 유효
+    ProcessOutcome *outcomes;
+
+    DeadlineMissInfo *misses; // EDF/RMS 데드라인 미스 기록
+    int miss_count;           // 미스 수 (기록을 남기지 않아도 셈)
+    int miss_capacity;
+
+    AgingLogEntry *aging_log; // Priority with Aging 변경 기록
+    int aging_count;
+    int aging_capacity;
+
+    int completed; // 완료된 프로세스(인스턴스) 수
+    long long total_waiting;
+    long long total_turnaround;
+    long long total_response; // 완료된 프로세스의 응답 시간 합
+
+    // 코어 수와 코어별 간트차트/실행 시간 (core_count가 2 이상일 때만
+    // core_gantt와 core_busy를 채우고, 단일 CPU는 gantt에 기록)
+    // idle_time은 모든 코어의 유휴 시간 합
+    int core_count;
+    GanttChart *core_gantt;
+    int *core_busy;    // 실행 시간 (전환/이전 비용 포함)
+    int *core_misses;  // EDF/RMS 데드라인 미스 수 (작업을 끝낸 코어 기준)
+    int steals;        // 작업 훔치기 횟수
+    int migrations;    // 다른 코어로 옮겨진 횟수 (훔치기, global 재실행)
+
+    // 문맥 전환: 코어가 다른 작업으로 바꿔 올린 횟수와
+    // 전환/이전 비용으로 쓴 시간 (모든 코어 합, 단일 CPU도 기록)
+    int switches;
+    int overhead_time;
+
+    // SIM_STEADY_STATE로 외삽한 경우 반복이 확인된 시각과 하이퍼피리어드
+    // (steady_from이 -1이면 끝까지 시뮬레이션함)
+    int steady_from;
+    int hyperperiod;
+} SimulationResult;
+
+// processes: EDF/RMS는 원본 태스크 배열, 나머지는 실행 대상 배열 (수정하지 않음)
+// quantum: RR 타임 퀀텀, max_time: EDF/RMS 시뮬레이션 종료 시각
+// flags: SimulationFlag 조합
+//   SIM_DETAILED가 없으면 간트차트와 인스턴스/미스/aging 기록 없이 합계만
+//   남긴다 (EDF/RMS는 동시에 살아 있는 인스턴스 수만큼의 메모리로 실행)
+//   SIM_STEADY_STATE는 기록을 남기지 않는 EDF/RMS 실행에만 적용된다
+// cpu: 코어 수와 배정 방식 (NULL이면 단일 CPU)
+//   partitioned EDF/RMS는 cpu->partition 방식으로 태스크를 코어에 나눈다
+//   SIM_STEADY_STATE는 전환 비용이 없는 단일 CPU에서만 적용된다
+// state: 실행 상태와 결과를 기록할 영역 (여러 실행에 재사용 가능)
+void simulate(SchedulingPolicy policy, const Process *processes, int count,
+              int quantum, int max_time, int flags, const CpuConfig *cpu,
+              SchedState *state, SimulationResult *result);
+int simulate_stream(SchedulingPolicy policy, WorkloadReader *reader,
+                    int quantum, SimulationResult *result);
+void free_simulation_result(SimulationResult *result);
+
+#endif
@@ -1,27 +1,44 @@
 #ifndef EVALUATION_H
 #define EVALUATION_H
 
+#include "arena.h"
 #include "config.h"
 #include "process.h"
 
+#include <stdio.h>
+
+// 비교 지표 출력 형식
+typedef enum {
+    OUTPUT_TEXT,
+    OUTPUT_CSV,
+    OUTPUT_JSON
+} OutputFormat;
+
+typedef enum {
+    GANTT_RUN,
+    GANTT_IDLE,
+    GANTT_MIGRATION, // 다른 코어에서 옮겨 온 작업의 이전 비용 (실행 전)
+    GANTT_SWITCH     // 문맥 전환 비용 (실행 전)
+} GanttStatus;
+
 typedef struct {
     int time_start;
     int time_end;
     int process_id;
-    char status[10]; // "RUN", "IDLE"
+    GanttStatus status;
 } GanttEntry;
 
+// 같은 상태가 이어지는 구간은 하나의 엔트리로 기록 (run-length)
 typedef struct {
     GanttEntry *entries;
     int count;
     int capacity;
+    Arena *arena; // 엔트리를 할당할 arena (NULL이면 일반 힙)
 } GanttChart;
 
 typedef struct {
     int total_time;
     int idle_time;
-    Process *for_edf_rms_processes;
-    int for_edf_rms_counter;
 } Metrics;
 
 typedef struct {
@@ -32,6 +49,12 @@ typedef struct {
     float throughput;
     int total_time;
     int missed_deadlines;
+    int cores;
+    float p95_turnaround; // 반환 시간 95번째 백분위 (-1: 계산하지 않음)
+    int steals;           // 작업 훔치기 횟수
+    int migrations;       // 다른 코어로 옮겨진 횟수
+    int switches;         // 문맥 전환 횟수
+    int overhead_time;    // 문맥 전환/이전 비용으로 쓴 시간
 } AlgorithmMetrics;
 
 void print_thin_emphasized_header(const char *title, int width);
@@ -43,19 +66,29 @@ void display_metrics(Process *processes, int count, int total_time,
                      int idle_time);
 void compare_algorithms(Process *processes, int count, Config *config,
                         int max_time);
+void write_algorithm_metrics(FILE *fp, AlgorithmMetrics *metrics, int count,
+                             OutputFormat format);
 
-void display_performance_summary(Process *processes, int count, int total_time,
-                                 int idle_time);
-void display_process_table(Process *processes, int count);
+void display_performance_summary(Process *processes, ProcessOutcome *outcomes,
+                                 int count, int total_time, int idle_time,
+                                 int cores, int switches, int overhead_time);
+void display_process_table(Process *processes, ProcessOutcome *outcomes,
+                           int count);
 void display_io_statistics(Process *processes, int count);
 
-GanttChart *consolidate_gantt_chart(GanttChart *original);
+void init_gantt_chart(GanttChart *gantt, int capacity, Arena *arena);
+void free_gantt_chart(GanttChart *gantt);
 void add_gantt_entry(GanttChart *gantt, int start, int end, int pid,
-                     const char *status);
+                     GanttStatus status);
 void display_gantt_chart(GanttChart *gantt, const char *algorithm_name);
-void display_scheduling_results(Process *processes, int count,
-                                GanttChart *gantt, int total_time,
-                                int idle_time, const char *algorithm_name);
+void display_core_gantt_charts(GanttChart *lanes, int cores,
+                               const char *algorithm_name);
+void display_core_utilization(const int *core_busy, int cores,
+                              int total_time);
+void display_scheduling_results(Process *processes, ProcessOutcome *outcomes,
+                                int count, GanttChart *gantt, int total_time,
+                                int idle_time, int switches, int overhead_time,
+                                const char *algorithm_name);
 void save_processes_to_file(Process *processes, int count);
 
 void print_utilization_analysis(Process *original_processes, int count,
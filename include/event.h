@@ -0,0 +1,56 @@
+#ifndef EVENT_H
+#define EVENT_H
+
+#include "arena.h"
+
+// 이벤트 큐에 들어가는 외부 이벤트 종류
+// (실행 중인 프로세스의 버스트 완료, I/O 시작, 타임 퀀텀 만료는
+//  엔진이 실행 구간의 끝으로 직접 계산한다)
+typedef enum {
+    EVENT_AGING,      // aging 임계값 도달 (Priority with Aging)
+    EVENT_ARRIVAL,    // 프로세스 도착 / 주기 작업 릴리즈
+    EVENT_IO_COMPLETE // I/O 완료
+} EventType;
+
+typedef struct {
+    int time;       // 발생 시각
+    int order;      // 같은 시각 이벤트 간 처리 순서
+    int pid;        // 대상 프로세스 (EDF/RMS 도착은 태스크 번호)
+    long key;       // 같은 시각, 같은 순서일 때의 처리 순서 (보통 pid)
+    EventType type; // 이벤트 종류
+} Event;
+
+// 타이밍 휠 칸 수 (2의 거듭제곱)
+// I/O 완료, aging처럼 가까운 미래의 이벤트는 휠에 넣어 O(1)로 처리하고
+// 휠 범위를 벗어나는 도착 이벤트 등만 힙에 넣는다
+#define EVENT_WHEEL_SIZE 64
+
+// 휠의 한 칸: 같은 시각의 이벤트들을 (order, key) 순으로 보관
+typedef struct {
+    Event *items;
+    int head;
+    int count;
+    int capacity;
+} EventBucket;
+
+// (time, order, key) 기준 최소 우선순위 큐
+// 휠은 [base, base + EVENT_WHEEL_SIZE) 구간을 덮으므로 칸 하나에는 한 시각만 들어간다
+typedef struct {
+    Event *data; // 휠 범위 밖 이벤트의 최소 힙
+    int count;
+    int capacity;
+    EventBucket wheel[EVENT_WHEEL_SIZE];
+    unsigned long long occupied; // 비어 있지 않은 칸 비트맵
+    int base;                    // 휠이 덮는 구간의 시작 시각
+    int wheel_count;
+    Arena *arena; // 버퍼를 할당할 arena (NULL이면 일반 힙)
+} EventQueue;
+
+void init_event_queue(EventQueue *q, int capacity, Arena *arena);
+void free_event_queue(EventQueue *q);
+int is_event_queue_empty(EventQueue *q);
+void push_event(EventQueue *q, Event event);
+Event pop_event(EventQueue *q);
+Event peek_event(EventQueue *q);
+
+#endif
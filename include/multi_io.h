@@ -1,13 +1,18 @@
 #ifndef MULTI_IO_H
 #define MULTI_IO_H
 
-// 최대 I/O 작업 수 정의
-#define MAX_IO_OPERATIONS 3
-
 // I/O 작업 구조체
 typedef struct {
     int io_start; // I/O가 시작되는 CPU 실행 시점
     int io_burst; // I/O 지속 시간
 } IOOperation;
 
+// 여러 프로세스의 I/O 작업을 이어 붙여 두는 공유 배열 (CSR 형식)
+// 각 프로세스는 자기 구간의 시작 위치와 개수만 가진다
+typedef struct {
+    IOOperation *ops;
+    long count;
+    long capacity;
+} IOArena;
+
 #endif
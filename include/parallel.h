@@ -0,0 +1,11 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+// index 번째 작업을 처리하는 함수 (여러 스레드에서 동시에 호출됨)
+typedef void (*ParallelTask)(void *arg, int index);
+
+int default_thread_count(void);
+void parallel_for(int task_count, int thread_count, ParallelTask task,
+                  void *arg);
+
+#endif
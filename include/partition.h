@@ -0,0 +1,30 @@
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include "config.h"
+#include "process.h"
+
+// 주기 태스크를 코어에 나누고 코어마다 단일 CPU 스케줄 가능성을 검사
+//
+// 코어가 태스크를 받아 주는 기준은 그 코어의 태스크 집합에 대한 검사다
+// 모든 태스크의 데드라인이 주기 이상이면 이용률 상한(EDF 1, RMS
+// n(2^(1/n) - 1))으로 먼저 받아 주고, 상한을 넘거나 데드라인이 주기보다
+// 짧으면 응답 시간 분석(RMS) 또는 프로세서 요구량 검사(EDF)로 판정한다
+
+// 코어마다 적용할 스케줄링 방식
+typedef enum {
+    CORE_TEST_EDF,
+    CORE_TEST_RMS
+} CoreTest;
+
+int partition_tasks(const Process *tasks, int count, int cores,
+                    PartitionFit fit, CoreTest test, int *assignment);
+int minimum_partition_cores(const Process *tasks, int count, PartitionFit fit,
+                            CoreTest test);
+const char *partition_fit_name(PartitionFit fit);
+void print_partition_table(const Process *tasks, int count, int cores,
+                           PartitionFit fit, CoreTest test,
+                           const int *core_misses);
+void print_minimum_cores(const Process *tasks, int count);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include "arena.h"
+
+// 정수 키 배열 기준 이진 최소 힙 (pid 저장)
+// 키가 같으면 먼저 들어온(또는 먼저 키가 바뀐) 프로세스가 앞선다
+typedef struct {
+    int *heap;          // 힙 순서의 pid 배열
+    int count;
+    int capacity;
+    int *position;      // pid → 힙 인덱스 (-1: 큐에 없음)
+    long *sequence;     // pid → 동점 처리용 순번
+    int pid_capacity;   // position / sequence 배열 크기
+    long next_sequence;
+    const int *keys;    // pid → 정렬 키 (작을수록 앞, 호출한 쪽이 관리)
+    Arena *arena;       // 배열을 할당할 arena (NULL이면 일반 힙)
+} PriorityQueue;
+
+void init_priority_queue(PriorityQueue *pq, const int *keys,
+                         int pid_capacity, Arena *arena);
+void free_priority_queue(PriorityQueue *pq);
+int pq_is_empty(PriorityQueue *pq);
+int pq_contains(PriorityQueue *pq, int pid);
+void pq_push(PriorityQueue *pq, int pid);
+int pq_pop(PriorityQueue *pq);
+int pq_peek(PriorityQueue *pq);
+void pq_update(PriorityQueue *pq, int pid);
+void pq_remove(PriorityQueue *pq, int pid);
+int pq_compare(PriorityQueue *pq, int pid1, int pid2);
+
+#endif
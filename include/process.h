@@ -10,19 +10,22 @@ typedef struct {
     int pid;                                      // 프로세스 ID
     int arrival_time;                             // 도착 시간
     int cpu_burst;                                // CPU 버스트 시간
-    IOOperation io_operations[MAX_IO_OPERATIONS]; // I/O 작업 배열
+    IOOperation *io_operations; // 공유 I/O 배열 안의 이 프로세스 구간
+    int io_count;               // I/O 작업 수 (io_start 오름차순)
     int priority;             // 우선순위 (낮을수록 높은 우선순위)
-    int remaining_time;       // 남은 실행 시간(선점형 알고리즘용)
-    int progress;             // 프로세스 진행 상태
-    int comp_time;            // 완료 시간
-    int waiting_time;         // 대기 시간
-    int turnaround_time;      // 반환 시간
-    int waiting_time_counter; // 대기 시간 카운터
     int deadline;             // 데드라인
     int period;               // 주기
-    int missed_deadline;      // 데드라인 미스 여부 (EDF, RMS 알고리즘용)
 } Process;
 
+// 시뮬레이션 한 번의 프로세스별 결과 (워크로드와 따로 실행마다 기록)
+typedef struct {
+    int comp_time;       // 완료 시간
+    int waiting_time;    // 대기 시간
+    int turnaround_time; // 반환 시간
+    int missed_deadline; // 데드라인 미스 여부 (EDF, RMS 알고리즘용)
+    int response_time;   // 응답 시간 (도착부터 처음 실행될 때까지)
+} ProcessOutcome;
+
 typedef struct {
     int pid;               // 프로세스 ID
     int arrival_time;      // 도착 시간
@@ -37,17 +40,18 @@ typedef struct {
 
 // 기존 프로세스 생성 및 관리 함수들
 Process *create_processes(int *count, char mode);
-void reset_processes(Process *processes, int count);
+Process *load_processes_from_file(const char *filepath, int *count);
+int order_processes_by_pid(Process *processes, int count);
 int rand_except(int min, int max, int exclude);
 
 // 멀티 I/O 관련 함수들
 void init_process_io(Process *p);
-void add_io_to_process(Process *p, int io_start, int io_burst);
-int get_io_count(Process *p);
+void init_io_arena(IOArena *arena, long capacity);
+void free_io_arena(IOArena *arena);
+void append_io_operations(IOArena *arena, const IOOperation *ops, int count);
+void add_io_to_process(IOArena *arena, Process *p, int io_start, int io_burst);
+Process *attach_io_arena(Process *processes, int count, IOArena *arena);
+int get_total_io_time(const Process *p);
 int is_time_used(int *used_times, int count, int time);
 
-// I/O 처리 관련 함수들
-int has_io_at_progress(Process *p, int progress);
-int get_io_burst_at_progress(Process *p, int progress);
-
 #endif
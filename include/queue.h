@@ -1,20 +1,28 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-#define MAX_QUEUE_SIZE 100
+#include "arena.h"
 
+#define QUEUE_DEFAULT_CAPACITY 16
+
+// 가득 차면 두 배로 늘어나는 원형 큐
 typedef struct {
-    int data[MAX_QUEUE_SIZE];
+    int *data;
     int front;
     int rear;
     int count;
+    int capacity;
+    Arena *arena; // 버퍼를 할당할 arena (NULL이면 일반 힙)
 } Queue;
 
 void init_queue(Queue *q);
+void init_queue_with_capacity(Queue *q, int capacity, Arena *arena);
+void free_queue(Queue *q);
 int is_empty(Queue *q);
 int is_full(Queue *q);
-void enqueue(Queue *q, int value);
+int enqueue(Queue *q, int value);
 int dequeue(Queue *q);
 int peek(Queue *q);
+int queue_remove_at(Queue *q, int index);
 
 #endif
@@ -0,0 +1,34 @@
+#ifndef SCHED_STATE_H
+#define SCHED_STATE_H
+
+#include "arena.h"
+#include "process.h"
+
+// 시뮬레이션 한 번의 프로세스별 상태와 결과 (실행마다 재사용하는 영역)
+// Process 배열은 바뀌지 않는 워크로드로 두고, 엔진이 자주 읽고 쓰는 값만
+// 필드별 배열로 모아 ready queue 비교와 순회가 연속된 메모리를 읽도록 한다
+//
+// begin_sched_run은 실행 번호만 올리므로 O(1)이고, 각 슬롯은 엔진이
+// 처음 사용할 때 stamp를 보고 초기화한다
+//
+// scratch는 이벤트 큐, ready queue, 간트차트처럼 실행 한 번 동안만 쓰는
+// 버퍼를 담는 arena로, begin_sched_run에서 한꺼번에 비워 다음 실행이 재사용한다
+typedef struct {
+    int *key;         // ready queue 정렬 키 (남은 시간/우선순위/데드라인/주기)
+    int *progress;    // 지금까지 실행한 CPU 시간
+    int *io_cursor;   // progress 이후 첫 I/O 작업의 인덱스
+    int *ready_since; // ready queue에 들어간 시각
+    int *waiting;     // 누적 대기 시간
+    ProcessOutcome *outcome; // 완료 시각 등 실행 결과
+    unsigned *stamp;         // 슬롯을 마지막으로 초기화한 실행 번호
+    unsigned generation;     // 현재 실행 번호
+    int capacity;
+    Arena scratch;           // 실행 한 번 동안 쓰는 임시 버퍼
+} SchedState;
+
+void init_sched_state(SchedState *state, int capacity);
+void grow_sched_state(SchedState *state, int capacity);
+void begin_sched_run(SchedState *state);
+void free_sched_state(SchedState *state);
+
+#endif
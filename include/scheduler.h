@@ -2,6 +2,7 @@
 #define SCHEDULER_H
 
 #include "config.h"
+#include "engine.h"
 #include "evaluation.h"
 #include "process.h"
 #include "queue.h"
@@ -16,4 +17,29 @@ Metrics *run_priority_with_aging(Process *processes, int count);
 Metrics *run_edf(Process *processes, int count, Config *config, int max_time);
 Metrics *run_rms(Process *processes, int count, Config *config, int max_time);
 
+// 시뮬레이션(출력 없음)과 결과 출력을 나눠서 호출할 때 사용
+void simulate_policy(SchedulingPolicy policy, const Process *processes,
+                     int count, Config *config, int max_time,
+                     SchedState *state, SimulationResult *result);
+Metrics *report_simulation(SchedulingPolicy policy, Process *processes,
+                           int count, Config *config,
+                           SimulationResult *result);
+Metrics *run_policy(SchedulingPolicy policy, Process *processes, int count,
+                    Config *config, int max_time);
+
+// 여러 알고리즘을 같은 워크로드 위에서 병렬로 시뮬레이션
+typedef struct {
+    SchedulingPolicy policy;
+    SchedState state; // 이 실행 전용 상태와 결과
+    SimulationResult result;
+} PolicyRun;
+
+void simulate_policies(PolicyRun *runs, int run_count,
+                       const Process *workload, int count, Config *config,
+                       int max_time);
+void free_policy_run(PolicyRun *run);
+const char *policy_name(SchedulingPolicy policy);
+void collect_algorithm_metrics(AlgorithmMetrics *m, SchedulingPolicy policy,
+                               SimulationResult *result);
+
 #endif
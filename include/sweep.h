@@ -0,0 +1,41 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include "config.h"
+#include "evaluation.h"
+#include "process.h"
+#include <stdio.h>
+
+#define SWEEP_MAX_QUANTA 1024 // 한 번에 실행할 수 있는 최대 퀀텀 수
+
+// Round Robin 타임 퀀텀을 바꿔 가며 같은 워크로드를 시뮬레이션
+//
+// 퀀텀 범위: first부터 last까지 step씩 늘리거나 (factor가 0),
+// factor배씩 늘린다 (로그 스케일, 반올림해 같아진 값은 한 번만 실행)
+// last를 넘는 값은 실행하지 않으므로 last가 격자에 없으면 빠진다
+typedef struct {
+    int first;
+    int last;
+    int step;
+    double factor;
+} QuantumRange;
+
+// 퀀텀 하나의 실행 결과 (완료된 프로세스 기준 평균)
+typedef struct {
+    int quantum;
+    double avg_waiting;
+    double avg_turnaround;
+    double avg_response;
+    int switches;      // 문맥 전환 횟수
+    int overhead_time; // 전환/이전 비용으로 쓴 시간
+    int total_time;
+} SweepPoint;
+
+int quantum_range_values(const QuantumRange *range, int *quanta);
+void sweep_quantum(const Process *processes, int count, const int *quanta,
+                   int quantum_count, const CpuConfig *cpu,
+                   int worker_threads, SweepPoint *points);
+void write_sweep_results(FILE *fp, const SweepPoint *points, int count,
+                         OutputFormat format);
+
+#endif
@@ -11,16 +11,13 @@ typedef enum {
     SORT_BY_PERIOD          // for RMS
 } SortCriteria;
 
-int compare_processes(Process *processes, int pid1, int pid2,
-                      SortCriteria criteria);
-void sort_queue(Queue *queue, Process *processes, SortCriteria criteria);
+int sort_key(const Process *p, SortCriteria criteria);
 
-void sort_io_operations(Process *p);
+void sort_io_operations(IOOperation *ops, int count);
 
-void add_io_to_process(Process *p, int io_start, int io_burst);
-int get_io_count(Process *p);
 int is_time_used(int *used_times, int count, int time);
-int has_io_at_progress(Process *p, int progress);
-int get_io_burst_at_progress(Process *p, int progress);
+int next_io_start(const Process *p, int progress, int *cursor);
+int take_io_at_progress(const Process *p, int progress, int *cursor,
+                        int *io_burst);
 
 #endif
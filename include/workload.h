@@ -0,0 +1,82 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "process.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define WORKLOAD_BUFFER_SIZE (1 << 20)
+
+// 바이너리 워크로드 형식
+// [WorkloadHeader][WorkloadRecord x process_count][WorkloadIO x io_count]
+// 모든 값은 little-endian 고정 폭 정수
+#define WORKLOAD_MAGIC "CPUW"
+#define WORKLOAD_VERSION 1
+
+typedef struct {
+    char magic[4];          // "CPUW"
+    uint32_t version;       // WORKLOAD_VERSION
+    uint32_t process_count; // 프로세스 레코드 수
+    uint32_t io_count;      // I/O 테이블 항목 수
+} WorkloadHeader;
+
+typedef struct {
+    int32_t pid;
+    int32_t arrival_time;
+    int32_t cpu_burst;
+    int32_t priority;
+    int32_t deadline;
+    int32_t period;
+    uint32_t io_offset; // I/O 테이블에서 첫 항목 위치
+    uint32_t io_count;  // I/O 항목 수 (io_start 오름차순)
+} WorkloadRecord;
+
+typedef struct {
+    int32_t io_start;
+    int32_t io_burst;
+} WorkloadIO;
+
+typedef enum {
+    WORKLOAD_TEXT,  // process-*.txt 형식
+    WORKLOAD_BINARY // 위의 바이너리 형식
+} WorkloadFormat;
+
+// 워크로드를 한 프로세스씩 읽는 리더
+// 텍스트는 큰 블록 단위로 read하면서 파싱하고,
+// 바이너리는 mmap한 레코드를 그대로 변환한다
+typedef struct {
+    const char *path;
+    int fd;
+    WorkloadFormat format;
+
+    // 텍스트 형식
+    char *buffer;
+    int size; // buffer에 채워진 바이트 수
+    int pos;  // 다음에 읽을 위치
+    int eof;
+    long line; // 오류 메시지용 현재 줄 번호
+
+    // 바이너리 형식
+    void *map;
+    size_t map_size;
+    const WorkloadRecord *records;
+    const WorkloadIO *io_table;
+    uint32_t io_count;
+
+    // 마지막으로 읽은 프로세스의 I/O (다음 read_workload_process까지 유효)
+    IOArena io_buffer;
+
+    int declared_count; // 파일에 기록된 프로세스 수
+    int read_count;     // 지금까지 읽은 프로세스 수
+} WorkloadReader;
+
+int open_workload(WorkloadReader *reader, const char *path);
+int read_workload_process(WorkloadReader *reader, Process *p);
+void close_workload(WorkloadReader *reader);
+
+void write_process_text(FILE *fp, Process *p);
+int convert_workload(const char *in_path, const char *out_path,
+                     WorkloadFormat format);
+
+#endif
@@ -0,0 +1,328 @@
+#include "analysis.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// 반복 계산에서 이 시각을 넘으면 상한이 없는 것으로 본다
+#define ANALYSIS_TIME_LIMIT (1LL << 40)
+// 이용률 비교의 부동소수점 오차 허용치
+#define UTILIZATION_EPSILON 1e-9
+
+typedef struct {
+    int pid;
+    long long wcet;
+    long long period;
+    long long deadline;
+} AnalysisTask;
+
+// Process 배열을 분석용 태스크로 변환 (주기가 없는 프로세스가 있으면 NULL)
+static AnalysisTask *load_tasks(const Process *tasks, int count) {
+    for (int i = 0; i < count; i++) {
+        if (tasks[i].period <= 0) {
+            printf("Process %d has no period; schedulability analysis "
+                   "needs periodic tasks\n",
+                   tasks[i].pid);
+            return NULL;
+        }
+    }
+
+    AnalysisTask *t = malloc(sizeof(AnalysisTask) * (count > 0 ? count : 1));
+    if (!t) {
+        perror("schedulability analysis");
+        exit(1);
+    }
+    for (int i = 0; i < count; i++) {
+        t[i].pid = tasks[i].pid;
+        t[i].wcet = (long long)tasks[i].cpu_burst + get_total_io_time(&tasks[i]);
+        t[i].period = tasks[i].period;
+        t[i].deadline = (long long)tasks[i].deadline - tasks[i].arrival_time;
+    }
+    return t;
+}
+
+static double utilization(const AnalysisTask *t, int count) {
+    double total = 0.0;
+    for (int i = 0; i < count; i++) {
+        total += (double)t[i].wcet / t[i].period;
+    }
+    return total;
+}
+
+static long long ceil_div(long long a, long long b) {
+    return (a + b - 1) / b;
+}
+
+// j가 i보다 우선순위가 높거나 같은지
+// (같은 우선순위는 먼저 릴리즈된 쪽이 먼저 실행되므로 간섭으로 계산)
+static int interferes(const AnalysisTask *j, const AnalysisTask *i,
+                      PriorityAssignment order) {
+    if (order == PRIORITY_DEADLINE_MONOTONIC)
+        return j->deadline <= i->deadline;
+    return j->period <= i->period;
+}
+
+// 길이 w 구간에서 i보다 우선순위가 높거나 같은 태스크들의 요구 시간
+static long long interference(const AnalysisTask *t, int count, int i,
+                              PriorityAssignment order, long long w) {
+    long long total = 0;
+    for (int j = 0; j < count; j++) {
+        if (j != i && interferes(&t[j], &t[i], order))
+            total += ceil_div(w, t[j].period) * t[j].wcet;
+    }
+    return total;
+}
+
+// 태스크 i의 최악 응답 시간 (상한이 없으면 -1)
+// 데드라인이 주기보다 길 수 있으므로 level-i 바쁜 구간 안의 작업을
+// 차례로 검사한다: q번째 작업의 완료 시점 w는
+// w = (q + 1)C_i + sum ceil(w / T_j) C_j 의 최소 고정점
+static long long worst_response(const AnalysisTask *t, int count, int i,
+                                PriorityAssignment order) {
+    double load = (double)t[i].wcet / t[i].period;
+    for (int j = 0; j < count; j++) {
+        if (j != i && interferes(&t[j], &t[i], order))
+            load += (double)t[j].wcet / t[j].period;
+    }
+    if (load > 1.0 + UTILIZATION_EPSILON)
+        return -1;
+
+    long long worst = 0;
+    long long w = 0;
+    for (long long q = 0;; q++) {
+        for (;;) {
+            long long next =
+                (q + 1) * t[i].wcet + interference(t, count, i, order, w);
+            if (next == w)
+                break;
+            w = next;
+            if (w > ANALYSIS_TIME_LIMIT)
+                return -1;
+        }
+
+        long long response = w - q * t[i].period;
+        if (response > worst)
+            worst = response;
+        if (w <= (q + 1) * t[i].period)
+            break; // 다음 작업이 릴리즈되기 전에 바쁜 구간이 끝남
+    }
+    return worst;
+}
+
+// 고정 우선순위(RMS/DM) 응답 시간 분석
+// out[i]에 태스크별 결과를 채우고, 모두 데드라인을 지키면 1, 아니면 0,
+// 분석할 수 없는 입력이면 -1
+int response_time_analysis(const Process *tasks, int count,
+                           PriorityAssignment order, TaskResponse *out) {
+    AnalysisTask *t = load_tasks(tasks, count);
+    if (!t)
+        return -1;
+
+    int schedulable = 1;
+    for (int i = 0; i < count; i++) {
+        TaskResponse *r = &out[i];
+        r->pid = t[i].pid;
+        r->wcet = t[i].wcet;
+        r->period = (int)t[i].period;
+        r->deadline = (int)t[i].deadline;
+        r->response = worst_response(t, count, i, order);
+        r->schedulable = r->response >= 0 && r->response <= t[i].deadline;
+        if (!r->schedulable)
+            schedulable = 0;
+    }
+
+    free(t);
+    return schedulable;
+}
+
+// 길이 time 구간 안에서 릴리즈되고 데드라인도 그 안에 있는 작업의 요구량 h(t)
+static long long demand(const AnalysisTask *t, int count, long long time) {
+    long long total = 0;
+    for (int i = 0; i < count; i++) {
+        if (time >= t[i].deadline)
+            total += ((time - t[i].deadline) / t[i].period + 1) * t[i].wcet;
+    }
+    return total;
+}
+
+// time보다 앞선 가장 늦은 절대 데드라인 (-1: 없음)
+static long long last_deadline_before(const AnalysisTask *t, int count,
+                                      long long time) {
+    long long last = -1;
+    for (int i = 0; i < count; i++) {
+        if (time <= t[i].deadline)
+            continue;
+        long long k = (time - 1 - t[i].deadline) / t[i].period;
+        long long d = t[i].deadline + k * t[i].period;
+        if (d > last)
+            last = d;
+    }
+    return last;
+}
+
+// 동기 바쁜 구간 길이 (상한을 넘으면 -1)
+static long long busy_period(const AnalysisTask *t, int count) {
+    long long w = 0;
+    for (int i = 0; i < count; i++) {
+        w += t[i].wcet;
+    }
+    for (;;) {
+        long long next = 0;
+        for (int i = 0; i < count; i++) {
+            next += ceil_div(w, t[i].period) * t[i].wcet;
+        }
+        if (next == w)
+            return w;
+        w = next;
+        if (w > ANALYSIS_TIME_LIMIT)
+            return -1;
+    }
+}
+
+// EDF 프로세서 요구량 검사 (임의 데드라인)
+// 모든 구간 t에서 h(t) <= t 이면 스케줄 가능하다. 검사 구간 L은 동기 바쁜
+// 구간과 (U < 1이면) Zhang-Burns 상한 중 작은 값이고, 그 안의 데드라인을
+// 전부 보는 대신 QPA로 L에서부터 거꾸로 필요한 점만 계산한다
+// 스케줄 가능하면 1, 아니면 0, 분석할 수 없는 입력이면 -1
+int processor_demand_test(const Process *tasks, int count, DemandResult *out) {
+    out->utilization = 0.0;
+    out->schedulable = 0;
+    out->interval = 0;
+    out->failure = -1;
+    out->checkpoints = 0;
+
+    AnalysisTask *t = load_tasks(tasks, count);
+    if (!t)
+        return -1;
+
+    out->utilization = utilization(t, count);
+
+    // 첫 작업이 데드라인 안에 끝날 수 없는 태스크
+    for (int i = 0; i < count; i++) {
+        if (t[i].deadline < t[i].wcet &&
+            (out->failure == -1 || t[i].deadline < out->failure))
+            out->failure = t[i].deadline;
+    }
+    if (out->failure != -1 ||
+        out->utilization > 1.0 + UTILIZATION_EPSILON) {
+        free(t);
+        return 0;
+    }
+
+    long long interval = busy_period(t, count);
+    if (interval < 0) {
+        free(t);
+        return 0; // 구간이 너무 길어 확인할 수 없음
+    }
+
+    long long min_deadline = t[0].deadline;
+    long long max_deadline = t[0].deadline;
+    double excess = 0.0;
+    for (int i = 0; i < count; i++) {
+        if (t[i].deadline < min_deadline)
+            min_deadline = t[i].deadline;
+        if (t[i].deadline > max_deadline)
+            max_deadline = t[i].deadline;
+        excess += (double)(t[i].period - t[i].deadline) * t[i].wcet /
+                  t[i].period;
+    }
+    if (out->utilization < 1.0 - UTILIZATION_EPSILON) {
+        double bound = excess / (1.0 - out->utilization);
+        long long zhang_burns = max_deadline;
+        if (bound > (double)zhang_burns)
+            zhang_burns = (long long)bound + 1;
+        if (zhang_burns < interval)
+            interval = zhang_burns;
+    }
+    out->interval = interval;
+
+    // QPA: h(t) < t 이면 t를 h(t)로 당기고, h(t) == t 이면 바로 앞 데드라인으로
+    long long time = last_deadline_before(t, count, interval + 1);
+    while (time >= 0) {
+        long long h = demand(t, count, time);
+        out->checkpoints++;
+        if (h > time) {
+            out->failure = time;
+            free(t);
+            return 0;
+        }
+        if (h <= min_deadline)
+            break;
+        time = h < time ? h : last_deadline_before(t, count, time);
+    }
+
+    out->schedulable = 1;
+    free(t);
+    return 1;
+}
+
+static const char *assignment_name(PriorityAssignment order) {
+    return order == PRIORITY_DEADLINE_MONOTONIC ? "Deadline Monotonic"
+                                                : "Rate Monotonic";
+}
+
+// 태스크별 최악 응답 시간 표
+void print_response_times(const Process *tasks, int count,
+                          PriorityAssignment order) {
+    TaskResponse *responses =
+        malloc(sizeof(TaskResponse) * (count > 0 ? count : 1));
+    if (!responses) {
+        perror("schedulability analysis");
+        exit(1);
+    }
+
+    int status = response_time_analysis(tasks, count, order, responses);
+    if (status < 0) {
+        free(responses);
+        return;
+    }
+
+    printf("\n** Response-Time Analysis (%s) **\n", assignment_name(order));
+    printf("+------+-------------+----------+----------+------------+---------"
+           "-----+\n");
+    printf("| PID  | CPU + I/O   | Period   | Deadline | WCRT       | Result  "
+           "     |\n");
+    printf("+------+-------------+----------+----------+------------+---------"
+           "-----+\n");
+    for (int i = 0; i < count; i++) {
+        TaskResponse *r = &responses[i];
+        char wcrt[24];
+        if (r->response < 0)
+            snprintf(wcrt, sizeof(wcrt), "unbounded");
+        else
+            snprintf(wcrt, sizeof(wcrt), "%lld", r->response);
+        printf("| P%-3d | %-11lld | %-8d | %-8d | %-10s | %-12s |\n", r->pid,
+               r->wcet, r->period, r->deadline, wcrt,
+               r->schedulable ? "OK" : "MISS");
+    }
+    printf("+------+-------------+----------+----------+------------+---------"
+           "-----+\n");
+    printf("- %s: %s\n", assignment_name(order),
+           status ? "SCHEDULABLE" : "NOT SCHEDULABLE");
+
+    free(responses);
+}
+
+// RMS/DM 응답 시간 분석과 EDF 요구량 검사를 모두 출력 (시뮬레이션 없음)
+// 분석할 수 없는 입력이면 -1
+int print_schedulability_analysis(const Process *tasks, int count) {
+    DemandResult edf;
+    if (processor_demand_test(tasks, count, &edf) < 0)
+        return -1;
+
+    printf("\n** Schedulability Analysis (%d tasks, U = %.4f) **\n", count,
+           edf.utilization);
+
+    print_response_times(tasks, count, PRIORITY_RATE_MONOTONIC);
+    print_response_times(tasks, count, PRIORITY_DEADLINE_MONOTONIC);
+
+    printf("\n** Processor Demand Test (EDF) **\n");
+    if (edf.interval > 0) {
+        printf("- Checked interval: %lld (%ld demand points)\n",
+               edf.interval, edf.checkpoints);
+    }
+    if (edf.failure >= 0) {
+        printf("- Demand exceeds available time at t = %lld\n", edf.failure);
+    }
+    printf("- EDF: %s\n", edf.schedulable ? "SCHEDULABLE" : "NOT SCHEDULABLE");
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN 16
+#define ALIGN_UP(n) (((n) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+struct ArenaBlock {
+    ArenaBlock *next;
+    size_t size; // data 영역 크기
+    size_t used;
+};
+
+// 블록 헤더 뒤의 data 영역 (정렬 단위에 맞춤)
+#define BLOCK_DATA(block) ((char *)(block) + ALIGN_UP(sizeof(ArenaBlock)))
+
+static void *check_alloc(void *ptr) {
+    if (!ptr) {
+        perror("arena");
+        exit(1);
+    }
+    return ptr;
+}
+
+static ArenaBlock *new_block(size_t size) {
+    ArenaBlock *block =
+        check_alloc(malloc(ALIGN_UP(sizeof(ArenaBlock)) + size));
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+static void free_blocks(ArenaBlock *block) {
+    while (block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+}
+
+void init_arena(Arena *arena) {
+    arena->blocks = NULL;
+    arena->reserved = 0;
+    arena->last = NULL;
+}
+
+// size 바이트 할당 (메모리가 부족하면 종료)
+// 현재 블록에 자리가 없으면 지금까지의 총량만큼 새 블록을 잡아
+// 실행 한 번의 블록 수가 로그 단위로만 늘어나게 한다
+void *arena_alloc(Arena *arena, size_t size) {
+    if (!arena)
+        return check_alloc(malloc(size ? size : 1));
+
+    size = ALIGN_UP(size ? size : 1);
+    ArenaBlock *block = arena->blocks;
+    if (!block || block->size - block->used < size) {
+        size_t block_size = arena->reserved;
+        if (block_size < ARENA_MIN_BLOCK_SIZE)
+            block_size = ARENA_MIN_BLOCK_SIZE;
+        if (block_size < size)
+            block_size = size;
+        block = new_block(block_size);
+        block->next = arena->blocks;
+        arena->blocks = block;
+        arena->reserved += block_size;
+    }
+
+    void *ptr = BLOCK_DATA(block) + block->used;
+    block->used += size;
+    arena->last = ptr;
+    return ptr;
+}
+
+// 배열 크기 변경 (old_size 바이트까지 내용 유지)
+// 마지막 할당이고 현재 블록에 자리가 있으면 복사 없이 제자리에서 늘린다
+void *arena_realloc(Arena *arena, void *ptr, size_t old_size,
+                    size_t new_size) {
+    if (!arena)
+        return check_alloc(realloc(ptr, new_size ? new_size : 1));
+    if (!ptr)
+        return arena_alloc(arena, new_size);
+
+    if (ptr == arena->last) {
+        ArenaBlock *block = arena->blocks;
+        size_t offset = (size_t)((char *)ptr - BLOCK_DATA(block));
+        size_t size = ALIGN_UP(new_size ? new_size : 1);
+        if (block->size - offset >= size) {
+            block->used = offset + size;
+            return ptr;
+        }
+    }
+
+    void *moved = arena_alloc(arena, new_size);
+    memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    return moved;
+}
+
+// arena 메모리는 reset_arena에서 한꺼번에 회수한다
+// 마지막 할당이면 그 자리를 바로 돌려준다
+void arena_free(Arena *arena, void *ptr) {
+    if (!arena) {
+        free(ptr);
+        return;
+    }
+    if (ptr && ptr == arena->last) {
+        ArenaBlock *block = arena->blocks;
+        block->used = (size_t)((char *)ptr - BLOCK_DATA(block));
+        arena->last = NULL;
+    }
+}
+
+// 모든 할당을 비움
+// 블록이 여러 개로 나뉘었으면 총량 크기의 블록 하나로 합쳐
+// 같은 크기의 다음 실행은 블록 하나 안에서 끝나게 한다
+void reset_arena(Arena *arena) {
+    ArenaBlock *block = arena->blocks;
+    if (block && block->next) {
+        free_blocks(block);
+        block = new_block(arena->reserved);
+        arena->blocks = block;
+    }
+    if (block)
+        block->used = 0;
+    arena->last = NULL;
+}
+
+void free_arena(Arena *arena) {
+    free_blocks(arena->blocks);
+    init_arena(arena);
+}
@@ -0,0 +1,716 @@
+#include "cli.h"
+#include "analysis.h"
+#include "config.h"
+#include "parallel.h"
+#include "partition.h"
+#include "process.h"
+#include "scheduler.h"
+#include "sweep.h"
+#include <errno.h>
+#include <getopt.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const char *key;
+    SchedulingPolicy policy;
+} PolicyKey;
+
+static const PolicyKey policy_keys[] = {
+    {"fcfs", POLICY_FCFS},
+    {"sjf-np", POLICY_SJF_NP},
+    {"sjf-p", POLICY_SJF_P},
+    {"priority-np", POLICY_PRIORITY_NP},
+    {"priority-p", POLICY_PRIORITY_P},
+    {"rr", POLICY_RR},
+    {"aging", POLICY_PRIORITY_AGING},
+    {"rms", POLICY_RMS},
+    {"edf", POLICY_EDF},
+};
+
+#define POLICY_KEY_COUNT ((int)(sizeof(policy_keys) / sizeof(policy_keys[0])))
+
+static void print_usage(const char *program) {
+    fprintf(stderr,
+            "Usage: %s -f FILE [options]\n"
+            "\n"
+            "  -f, --file FILE        process configuration file\n"
+            "  -a, --algorithms LIST  comma separated list (default: all)\n"
+            "                         fcfs, sjf-np, sjf-p, priority-np,\n"
+            "                         priority-p, rr, aging, rms, edf, all\n"
+            "  -q, --quantum N        Round Robin time quantum (default: %d)\n"
+            "  -t, --horizon N        simulation length for rms/edf\n"
+            "  -o, --format FORMAT    metrics format: text, csv, json\n"
+            "                         (default: text)\n"
+            "  -w, --output FILE      write metrics to FILE instead of stdout\n"
+            "  -l, --level LEVEL      per-algorithm output: full, summary,\n"
+            "                         metrics (default: full)\n"
+            "  -Q, --quiet            same as --level metrics\n"
+            "  -S, --stream           read the file while simulating; memory\n"
+            "                         stays bounded by the live processes.\n"
+            "                         File must be sorted by arrival time,\n"
+            "                         rms/edf are not supported\n"
+            "  -j, --threads N        simulation threads (default: CPU count)\n"
+            "  -c, --cores N          simulate N CPU cores (default: 1)\n"
+            "      --dispatch MODE    multi-core dispatch: global (one shared\n"
+            "                         ready queue) or partitioned (one queue\n"
+            "                         per core, processes pinned to a core)\n"
+            "      --steal POLICY     partitioned: idle cores take work from\n"
+            "                         the longest queue: half, oldest, or\n"
+            "                         shortest (least remaining burst)\n"
+            "      --switch-cost N    time a core spends switching to another\n"
+            "                         process before it runs (default: 0)\n"
+            "      --migration-cost N time a process spends moving to another\n"
+            "                         core before it runs: stolen processes,\n"
+            "                         or preempted processes resuming on a\n"
+            "                         different core with global dispatch\n"
+            "                         (default: 0)\n"
+            "      --partition FIT    partitioned rms/edf: assign tasks to\n"
+            "                         cores by first-, best- or worst-fit\n"
+            "                         decreasing utilization (first, best,\n"
+            "                         worst) instead of round-robin\n"
+            "      --analyze          check the task set with response-time\n"
+            "                         analysis (RM/DM) and the EDF demand\n"
+            "                         test instead of simulating, and the\n"
+            "                         fewest cores a partitioning needs\n"
+            "      --sweep-quantum R  run rr once per quantum in R and report\n"
+            "                         the best quantum for waiting,\n"
+            "                         turnaround and response time and for\n"
+            "                         context switches. R is LO:HI (every\n"
+            "                         quantum), LO:HI:STEP, or LO:HI:xF\n"
+            "                         (multiply by F each step, log scale).\n"
+            "                         Stops at the last quantum <= HI, so HI\n"
+            "                         is skipped when it is off the grid\n"
+            "      --steady-state     rms/edf: simulate until the schedule\n"
+            "                         repeats over a hyperperiod, then\n"
+            "                         extrapolate the metrics to --horizon\n"
+            "      --to-binary OUT    write FILE as a binary workload, then exit\n"
+            "      --to-text OUT      write FILE as a text workload, then exit\n"
+            "  -h, --help             show this help\n"
+            "\n"
+            "Without arguments the simulator runs in interactive mode.\n",
+            program, CLI_DEFAULT_QUANTUM);
+}
+
+// 음수가 아닌 정수 인자 파싱 (실패 시 -1)
+static int parse_count(const char *text, const char *option) {
+    char *end;
+    long value = strtol(text, &end, 10);
+
+    if (*text == '\0' || *end != '\0' || value < 0 || value > 1000000000) {
+        fprintf(stderr, "Invalid value for %s: %s\n", option, text);
+        return -1;
+    }
+    return (int)value;
+}
+
+static void add_policy(CliOptions *options, SchedulingPolicy policy) {
+    for (int i = 0; i < options->policy_count; i++) {
+        if (options->policies[i] == policy)
+            return; // 중복 지정은 한 번만 실행
+    }
+    options->policies[options->policy_count++] = policy;
+}
+
+static int parse_policy_list(const char *list, CliOptions *options) {
+    char *copy = strdup(list);
+    if (copy == NULL) {
+        perror("algorithm list");
+        exit(1);
+    }
+
+    int status = 0;
+    options->policy_count = 0;
+
+    for (char *save, *token = strtok_r(copy, ",", &save); token != NULL;
+         token = strtok_r(NULL, ",", &save)) {
+        if (strcmp(token, "all") == 0) {
+            for (int i = 0; i < POLICY_KEY_COUNT; i++) {
+                add_policy(options, policy_keys[i].policy);
+            }
+            continue;
+        }
+
+        int found = 0;
+        for (int i = 0; i < POLICY_KEY_COUNT; i++) {
+            if (strcmp(token, policy_keys[i].key) == 0) {
+                add_policy(options, policy_keys[i].policy);
+                found = 1;
+                break;
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "Unknown algorithm: %s\n", token);
+            status = -1;
+            break;
+        }
+    }
+
+    free(copy);
+    if (status == 0 && options->policy_count == 0) {
+        fprintf(stderr, "No algorithm selected\n");
+        status = -1;
+    }
+    return status;
+}
+
+static int parse_level(const char *text, OutputLevel *level) {
+    if (strcmp(text, "full") == 0) {
+        *level = OUTPUT_FULL;
+    } else if (strcmp(text, "summary") == 0) {
+        *level = OUTPUT_SUMMARY;
+    } else if (strcmp(text, "metrics") == 0) {
+        *level = OUTPUT_METRICS;
+    } else {
+        fprintf(stderr, "Unknown output level: %s\n", text);
+        return -1;
+    }
+    return 0;
+}
+
+static int parse_dispatch(const char *text, DispatchMode *dispatch) {
+    if (strcmp(text, "global") == 0) {
+        *dispatch = DISPATCH_GLOBAL;
+    } else if (strcmp(text, "partitioned") == 0) {
+        *dispatch = DISPATCH_PARTITIONED;
+    } else {
+        fprintf(stderr, "Unknown dispatch mode: %s\n", text);
+        return -1;
+    }
+    return 0;
+}
+
+static int parse_steal(const char *text, StealPolicy *steal) {
+    if (strcmp(text, "half") == 0) {
+        *steal = STEAL_HALF;
+    } else if (strcmp(text, "oldest") == 0) {
+        *steal = STEAL_OLDEST;
+    } else if (strcmp(text, "shortest") == 0) {
+        *steal = STEAL_SHORTEST;
+    } else {
+        fprintf(stderr, "Unknown steal policy: %s\n", text);
+        return -1;
+    }
+    return 0;
+}
+
+static int parse_partition(const char *text, PartitionFit *fit) {
+    if (strcmp(text, "first") == 0) {
+        *fit = PARTITION_FIRST_FIT;
+    } else if (strcmp(text, "best") == 0) {
+        *fit = PARTITION_BEST_FIT;
+    } else if (strcmp(text, "worst") == 0) {
+        *fit = PARTITION_WORST_FIT;
+    } else {
+        fprintf(stderr, "Unknown partitioning heuristic: %s\n", text);
+        return -1;
+    }
+    return 0;
+}
+
+// 범위의 정수 하나 파싱 (int를 넘으면 실패)
+static int parse_range_int(const char *text, char **end, int *value) {
+    errno = 0;
+    long parsed = strtol(text, end, 10);
+    if (*end == text || errno == ERANGE || parsed < INT_MIN ||
+        parsed > INT_MAX)
+        return -1;
+    *value = (int)parsed;
+    return 0;
+}
+
+// RR 퀀텀 범위 파싱: LO:HI, LO:HI:STEP, LO:HI:xFACTOR
+static int parse_sweep(const char *text, QuantumRange *range) {
+    char *end;
+    if (parse_range_int(text, &end, &range->first) != 0 || *end != ':')
+        goto invalid;
+    if (parse_range_int(end + 1, &end, &range->last) != 0)
+        goto invalid;
+    range->step = 1;
+    range->factor = 0.0;
+
+    if (*end == ':') {
+        const char *next = end + 1;
+        if (*next == 'x') {
+            next++;
+            // 퀀텀 계산이 long long을 넘지 않도록 배율도 int 범위로 제한
+            errno = 0;
+            range->factor = strtod(next, &end);
+            if (end == next || errno == ERANGE || !(range->factor > 1.0) ||
+                range->factor > INT_MAX)
+                goto invalid;
+        } else if (parse_range_int(next, &end, &range->step) != 0 ||
+                   range->step <= 0) {
+            goto invalid;
+        }
+    }
+    if (*end != '\0' || range->first <= 0 || range->last < range->first)
+        goto invalid;
+    return 0;
+
+invalid:
+    fprintf(stderr, "Invalid quantum range: %s (expected LO:HI, LO:HI:STEP "
+                    "or LO:HI:xFACTOR)\n",
+            text);
+    return -1;
+}
+
+static int parse_format(const char *text, OutputFormat *format) {
+    if (strcmp(text, "text") == 0) {
+        *format = OUTPUT_TEXT;
+    } else if (strcmp(text, "csv") == 0) {
+        *format = OUTPUT_CSV;
+    } else if (strcmp(text, "json") == 0) {
+        *format = OUTPUT_JSON;
+    } else {
+        fprintf(stderr, "Unknown output format: %s\n", text);
+        return -1;
+    }
+    return 0;
+}
+
+// 명령행 옵션 해석 (성공 0, 실패 -1, 도움말 출력 1)
+int parse_cli_options(int argc, char *argv[], CliOptions *options) {
+    static const struct option long_options[] = {
+        {"file", required_argument, NULL, 'f'},
+        {"algorithms", required_argument, NULL, 'a'},
+        {"quantum", required_argument, NULL, 'q'},
+        {"horizon", required_argument, NULL, 't'},
+        {"format", required_argument, NULL, 'o'},
+        {"output", required_argument, NULL, 'w'},
+        {"level", required_argument, NULL, 'l'},
+        {"quiet", no_argument, NULL, 'Q'},
+        {"stream", no_argument, NULL, 'S'},
+        {"threads", required_argument, NULL, 'j'},
+        {"cores", required_argument, NULL, 'c'},
+        {"dispatch", required_argument, NULL, 'D'},
+        {"steal", required_argument, NULL, 'W'},
+        {"switch-cost", required_argument, NULL, 'X'},
+        {"migration-cost", required_argument, NULL, 'M'},
+        {"partition", required_argument, NULL, 'R'},
+        {"sweep-quantum", required_argument, NULL, 'U'},
+        {"steady-state", no_argument, NULL, 'P'},
+        {"analyze", no_argument, NULL, 'A'},
+        {"to-binary", required_argument, NULL, 'B'},
+        {"to-text", required_argument, NULL, 'T'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+
+    memset(options, 0, sizeof(CliOptions));
+    options->quantum = CLI_DEFAULT_QUANTUM;
+    options->max_time = -1;
+    options->format = OUTPUT_TEXT;
+    options->level = OUTPUT_FULL;
+    options->cpu.cores = 1;
+    options->cpu.dispatch = DISPATCH_GLOBAL;
+    options->cpu.steal = STEAL_NONE;
+    options->cpu.switch_cost = 0;
+    options->cpu.migration_cost = 0;
+    options->cpu.partition = PARTITION_ROUND_ROBIN;
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "f:a:q:t:o:w:l:QSj:c:h", long_options,
+                              NULL)) != -1) {
+        switch (opt) {
+        case 'f':
+            options->workload_path = optarg;
+            break;
+        case 'a':
+            if (parse_policy_list(optarg, options) != 0)
+                return -1;
+            break;
+        case 'q':
+            options->quantum = parse_count(optarg, "--quantum");
+            if (options->quantum <= 0) {
+                if (options->quantum == 0)
+                    fprintf(stderr, "--quantum must be positive\n");
+                return -1;
+            }
+            break;
+        case 't':
+            options->max_time = parse_count(optarg, "--horizon");
+            if (options->max_time < 0)
+                return -1;
+            break;
+        case 'o':
+            if (parse_format(optarg, &options->format) != 0)
+                return -1;
+            break;
+        case 'w':
+            options->output_path = optarg;
+            break;
+        case 'l':
+            if (parse_level(optarg, &options->level) != 0)
+                return -1;
+            break;
+        case 'Q':
+            options->level = OUTPUT_METRICS;
+            break;
+        case 'S':
+            options->stream = 1;
+            break;
+        case 'j':
+            options->worker_threads = parse_count(optarg, "--threads");
+            if (options->worker_threads < 0)
+                return -1;
+            break;
+        case 'c':
+            options->cpu.cores = parse_count(optarg, "--cores");
+            if (options->cpu.cores <= 0) {
+                if (options->cpu.cores == 0)
+                    fprintf(stderr, "--cores must be positive\n");
+                return -1;
+            }
+            break;
+        case 'D':
+            if (parse_dispatch(optarg, &options->cpu.dispatch) != 0)
+                return -1;
+            break;
+        case 'W':
+            if (parse_steal(optarg, &options->cpu.steal) != 0)
+                return -1;
+            break;
+        case 'X':
+            options->cpu.switch_cost = parse_count(optarg, "--switch-cost");
+            if (options->cpu.switch_cost < 0)
+                return -1;
+            break;
+        case 'M':
+            options->cpu.migration_cost =
+                parse_count(optarg, "--migration-cost");
+            if (options->cpu.migration_cost < 0)
+                return -1;
+            break;
+        case 'R':
+            if (parse_partition(optarg, &options->cpu.partition) != 0)
+                return -1;
+            break;
+        case 'U':
+            if (parse_sweep(optarg, &options->sweep_range) != 0)
+                return -1;
+            options->sweep = 1;
+            break;
+        case 'P':
+            options->steady_state = 1;
+            break;
+        case 'A':
+            options->analyze = 1;
+            break;
+        case 'B':
+        case 'T':
+            options->convert_path = optarg;
+            options->convert_format =
+                opt == 'B' ? WORKLOAD_BINARY : WORKLOAD_TEXT;
+            break;
+        case 'h':
+            print_usage(argv[0]);
+            return 1;
+        default:
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if (optind < argc) {
+        fprintf(stderr, "Unexpected argument: %s\n", argv[optind]);
+        print_usage(argv[0]);
+        return -1;
+    }
+
+    if (options->workload_path == NULL) {
+        fprintf(stderr, "A workload file is required (--file)\n");
+        print_usage(argv[0]);
+        return -1;
+    }
+
+    if (options->convert_path != NULL || options->analyze)
+        return 0; // 변환 또는 분석만 수행
+
+    if (options->sweep) {
+        if (options->policy_count > 1 ||
+            (options->policy_count == 1 && options->policies[0] != POLICY_RR)) {
+            fprintf(stderr, "--sweep-quantum runs rr only\n");
+            return -1;
+        }
+        if (options->stream) {
+            fprintf(stderr, "--sweep-quantum cannot be used with --stream\n");
+            return -1;
+        }
+        options->policies[0] = POLICY_RR;
+        options->policy_count = 1;
+    }
+
+    if (options->policy_count == 0) {
+        for (int i = 0; i < POLICY_KEY_COUNT; i++) {
+            options->policies[options->policy_count++] = policy_keys[i].policy;
+        }
+    }
+
+    if (options->stream && options->cpu.cores > 1) {
+        fprintf(stderr, "--cores cannot be used with --stream\n");
+        return -1;
+    }
+
+    if (options->stream && options->cpu.switch_cost > 0) {
+        fprintf(stderr, "--switch-cost cannot be used with --stream\n");
+        return -1;
+    }
+
+    if (options->cpu.steal != STEAL_NONE &&
+        options->cpu.dispatch != DISPATCH_PARTITIONED) {
+        fprintf(stderr, "--steal requires --dispatch partitioned\n");
+        return -1;
+    }
+
+    if (options->cpu.partition != PARTITION_ROUND_ROBIN &&
+        options->cpu.dispatch != DISPATCH_PARTITIONED) {
+        fprintf(stderr, "--partition requires --dispatch partitioned\n");
+        return -1;
+    }
+
+    for (int i = 0; i < options->policy_count; i++) {
+        SchedulingPolicy policy = options->policies[i];
+        if (policy != POLICY_RMS && policy != POLICY_EDF)
+            continue;
+        if (options->stream) {
+            fprintf(stderr, "rms/edf cannot be used with --stream\n");
+            return -1;
+        }
+        if (options->max_time <= 0) {
+            fprintf(stderr, "rms/edf need a positive --horizon\n");
+            return -1;
+        }
+    }
+
+    // 상세 출력은 텍스트 형식에서만 (CSV/JSON 출력과 섞이지 않도록)
+    // 스트리밍과 정상 상태 외삽은 작업별 결과를 남기지 않으므로 지표만 출력
+    if (options->format != OUTPUT_TEXT || options->stream ||
+        options->steady_state)
+        options->level = OUTPUT_METRICS;
+
+    return 0;
+}
+
+// 워크로드 전체를 읽어 선택한 알고리즘을 실행 (성공 0)
+static int run_loaded(CliOptions *options, AlgorithmMetrics *metrics) {
+    int count = 0;
+    Process *processes =
+        load_processes_from_file(options->workload_path, &count);
+    if (processes == NULL) {
+        return 1;
+    }
+
+    Config config;
+    config.time_quantum = options->quantum;
+    config.mode = 'f';
+    config.deadline_miss_info_count = 0;
+    config.worker_threads = options->worker_threads;
+    config.output_level = options->level;
+    config.steady_state = options->steady_state;
+    config.cpu = options->cpu;
+
+    int run_count = options->policy_count;
+    PolicyRun *runs = malloc(sizeof(PolicyRun) * run_count);
+    if (runs == NULL) {
+        perror("batch run");
+        exit(1);
+    }
+
+    for (int i = 0; i < run_count; i++) {
+        runs[i].policy = options->policies[i];
+    }
+    simulate_policies(runs, run_count, processes, count, &config,
+                      options->max_time);
+
+    for (int i = 0; i < run_count; i++) {
+        collect_algorithm_metrics(&metrics[i], runs[i].policy,
+                                  &runs[i].result);
+
+        SimulationResult *result = &runs[i].result;
+        if (result->steady_from >= 0 && options->format == OUTPUT_TEXT) {
+            printf("%s: schedule repeats every %d from t=%d, "
+                   "extrapolated to t=%d\n",
+                   policy_name(runs[i].policy), result->hyperperiod,
+                   result->steady_from, result->total_time);
+        }
+
+        Metrics *report = report_simulation(runs[i].policy, processes, count,
+                                            &config, &runs[i].result);
+        free(report);
+        free_policy_run(&runs[i]);
+    }
+
+    if (options->level != OUTPUT_METRICS && options->output_path == NULL) {
+        printf("\n");
+    }
+
+    free(runs);
+    free(processes);
+    return 0;
+}
+
+typedef struct {
+    CliOptions *options;
+    AlgorithmMetrics *metrics;
+    int *status;
+} StreamBatch;
+
+// 알고리즘마다 파일을 따로 열어 도착 순서대로 읽으면서 시뮬레이션
+static void run_stream_task(void *arg, int index) {
+    StreamBatch *batch = (StreamBatch *)arg;
+    SchedulingPolicy policy = batch->options->policies[index];
+    WorkloadReader reader;
+    SimulationResult result;
+
+    batch->status[index] = 1;
+    if (open_workload(&reader, batch->options->workload_path) != 0)
+        return;
+
+    if (simulate_stream(policy, &reader, batch->options->quantum,
+                        &result) == 0) {
+        collect_algorithm_metrics(&batch->metrics[index], policy, &result);
+        batch->status[index] = 0;
+    }
+    free_simulation_result(&result);
+    close_workload(&reader);
+}
+
+static int run_streamed(CliOptions *options, AlgorithmMetrics *metrics) {
+    int *status = malloc(sizeof(int) * options->policy_count);
+    if (status == NULL) {
+        perror("batch run");
+        exit(1);
+    }
+
+    StreamBatch batch = {options, metrics, status};
+    parallel_for(options->policy_count, options->worker_threads,
+                 run_stream_task, &batch);
+
+    int failed = 0;
+    for (int i = 0; i < options->policy_count; i++) {
+        failed |= status[i];
+    }
+    free(status);
+    return failed;
+}
+
+// 시뮬레이션 없이 스케줄 가능성 분석만 출력 (성공 0)
+static int run_analysis(CliOptions *options) {
+    int count = 0;
+    Process *processes =
+        load_processes_from_file(options->workload_path, &count);
+    if (processes == NULL) {
+        return 1;
+    }
+
+    int status = print_schedulability_analysis(processes, count);
+    if (status == 0)
+        print_minimum_cores(processes, count);
+
+    free(processes);
+    return status < 0 ? 1 : 0;
+}
+
+// RR 퀀텀 범위를 병렬로 실행하고 퀀텀별 결과와 최적 퀀텀을 출력 (성공 0)
+static int run_sweep(CliOptions *options) {
+    int quanta[SWEEP_MAX_QUANTA];
+    int quantum_count = quantum_range_values(&options->sweep_range, quanta);
+    if (quantum_count < 0) {
+        fprintf(stderr, "--sweep-quantum covers more than %d quanta\n",
+                SWEEP_MAX_QUANTA);
+        return 1;
+    }
+
+    int count = 0;
+    Process *processes =
+        load_processes_from_file(options->workload_path, &count);
+    if (processes == NULL) {
+        return 1;
+    }
+
+    SweepPoint *points = malloc(sizeof(SweepPoint) * quantum_count);
+    if (points == NULL) {
+        perror("quantum sweep");
+        exit(1);
+    }
+    sweep_quantum(processes, count, quanta, quantum_count, &options->cpu,
+                  options->worker_threads, points);
+    free(processes);
+
+    FILE *out = stdout;
+    if (options->output_path != NULL) {
+        out = fopen(options->output_path, "w");
+        if (out == NULL) {
+            perror(options->output_path);
+            free(points);
+            return 1;
+        }
+    }
+
+    write_sweep_results(out, points, quantum_count, options->format);
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    free(points);
+    return 0;
+}
+
+// 프롬프트 없이 워크로드를 읽어 선택한 알고리즘을 실행하고 지표를 출력
+int run_batch(CliOptions *options) {
+    if (options->convert_path != NULL) {
+        return convert_workload(options->workload_path,
+                                options->convert_path,
+                                options->convert_format) == 0
+                   ? 0
+                   : 1;
+    }
+    if (options->analyze) {
+        return run_analysis(options);
+    }
+    if (options->sweep) {
+        return run_sweep(options);
+    }
+
+    // 출력은 큰 버퍼에 모았다가 한 번에 내보낸다
+    static char stdout_buffer[1 << 16];
+    setvbuf(stdout, stdout_buffer, _IOFBF, sizeof(stdout_buffer));
+
+    AlgorithmMetrics *metrics =
+        malloc(sizeof(AlgorithmMetrics) * options->policy_count);
+    if (metrics == NULL) {
+        perror("batch run");
+        exit(1);
+    }
+
+    int status = options->stream ? run_streamed(options, metrics)
+                                 : run_loaded(options, metrics);
+    if (status != 0) {
+        free(metrics);
+        return status;
+    }
+
+    FILE *out = stdout;
+    if (options->output_path != NULL) {
+        out = fopen(options->output_path, "w");
+        if (out == NULL) {
+            perror(options->output_path);
+            free(metrics);
+            return 1;
+        }
+    }
+
+    write_algorithm_metrics(out, metrics, options->policy_count,
+                            options->format);
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    free(metrics);
+    return 0;
+}
@@ -3,6 +3,16 @@
 #include <stdlib.h>
 // 설정 초기화
 void init_config(Config *config, char mode) {
+    config->worker_threads = 0;
+    config->output_level = OUTPUT_FULL;
+    config->steady_state = 0;
+    config->cpu.cores = 1;
+    config->cpu.dispatch = DISPATCH_GLOBAL;
+    config->cpu.steal = STEAL_NONE;
+    config->cpu.switch_cost = 0;
+    config->cpu.migration_cost = 0;
+    config->cpu.partition = PARTITION_ROUND_ROBIN;
+
     if (mode == 'y') {
         config->time_quantum = rand() % 3 + 1;
         config->mode = 'y';
@@ -0,0 +1,1477 @@
+#include "engine.h"
+#include "partition.h"
+#include "priority_queue.h"
+#include "sched_state.h"
+#include "utils.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 코어 하나의 실행 상태
+typedef struct {
+    int running;       // 실행 중인 프로세스 (-1: idle)
+    int quantum_used;  // 현재 실행 중인 프로세스가 사용한 타임 퀀텀
+    int busy_time;     // 프로세스를 실행한 시간 (전환/이전 비용 포함)
+    int last_job;      // 마지막으로 올린 작업 (-1: 끝났거나 없음)
+    int dispatched;    // 작업을 올린 적이 있는지
+    int switch_due;    // 실행 중인 작업이 진행하기 전에 남은 문맥 전환 비용
+    int migration_due; // 문맥 전환 뒤에 남은 이전 비용
+    int overhead;      // 직전 구간을 전환/이전 비용으로 썼는지
+} Core;
+
+// ready queue 하나 (global 배정이면 모든 코어가 하나를 공유)
+typedef struct {
+    Queue fifo;           // FCFS, RR: 도착 순서
+    PriorityQueue sorted; // 그 외: state.key 기준
+} ReadyQueue;
+
+// 시뮬레이션 한 번 동안 사용하는 엔진 상태
+typedef struct {
+    SchedulingPolicy policy;
+    const Process *processes; // 실행 대상 (EDF/RMS는 인스턴스 슬롯 배열)
+    Process *slots;     // 엔진이 만든 실행 대상 (EDF/RMS 인스턴스, 스트리밍)
+    int count;          // 실행 대상 수 (슬롯을 쓰면 지금까지 사용한 슬롯 수)
+    const Process *tasks; // EDF/RMS 원본 태스크
+    int task_count;
+    int *task_core; // partitioned EDF/RMS: 태스크별로 배정된 코어
+    int quantum;
+    int max_time;
+    int detailed; // 간트차트와 실행 기록(인스턴스, 미스, aging)을 남길지
+
+    SchedState *state;     // 슬롯별 실행 상태 (processes와 같은 인덱스)
+    SortCriteria criteria; // ready queue 정렬 기준
+
+    EventQueue events;
+    Core *cores;
+    int core_count;
+    int partitioned;   // 코어마다 ready queue를 두고 프로세스를 고정
+    ReadyQueue *ready; // partitioned면 코어마다 하나, 아니면 하나
+    int ready_count;
+    int *home;         // partitioned: 슬롯별 배정된 코어
+    int next_core;     // partitioned: 다음에 도착한 프로세스를 배정할 코어
+    StealPolicy steal; // partitioned: 빈 코어의 작업 훔치기 방식
+    int switch_cost;    // 코어가 다른 작업으로 바꿔 올릴 때마다 드는 시간
+    int migration_cost; // 작업이 다른 코어로 옮겨질 때마다 드는 시간
+    int *migration_left; // 슬롯별로 아직 치르지 않은 이전 비용
+    int *last_core; // global: 슬롯별로 마지막에 실행한 코어 (-1: 없음)
+    int time;
+    int completed;
+    int idle_time;
+    int *aging_due;  // 다음 aging 예정 시각 (-1: 없음)
+    int *candidates; // aging 대상 임시 배열
+    int *io_until;   // 정상 상태 탐지: 슬롯별 I/O 완료 시각 (-1: I/O 중 아님)
+
+    // 슬롯 풀: 스트리밍 입력과 EDF/RMS 인스턴스는 완료된 슬롯을 재사용
+    WorkloadReader *source; // NULL이면 processes 배열 전체를 사용
+    int capacity;           // processes 슬롯 수
+    long *keys; // 슬롯별 입력/릴리즈 순서 (같은 시각 이벤트 순서)
+    IOArena *slot_io; // 스트리밍: 슬롯별 I/O 작업 (슬롯과 함께 재사용)
+    int *free_slots;        // 완료되어 비어 있는 슬롯
+    int free_count;
+    long next_key;
+    int last_arrival;
+    int live;        // 읽었지만 아직 완료되지 않은 프로세스 수
+    int source_done; // 더 읽을 프로세스가 없음
+    int source_error;
+
+    SimulationResult *result;
+} Engine;
+
+static int is_real_time(SchedulingPolicy policy) {
+    return policy == POLICY_RMS || policy == POLICY_EDF;
+}
+
+static int is_preemptive(SchedulingPolicy policy) {
+    return policy == POLICY_SJF_P || policy == POLICY_PRIORITY_P ||
+           policy == POLICY_PRIORITY_AGING || is_real_time(policy);
+}
+
+// ready queue를 정렬해서 고르는 정책인지 (FCFS, RR은 도착 순서)
+static int uses_sorted_ready(SchedulingPolicy policy) {
+    return policy != POLICY_FCFS && policy != POLICY_RR;
+}
+
+static SortCriteria policy_criteria(SchedulingPolicy policy) {
+    switch (policy) {
+    case POLICY_SJF_NP:
+    case POLICY_SJF_P:
+        return SORT_BY_REMAINING_TIME;
+    case POLICY_RMS:
+        return SORT_BY_PERIOD;
+    case POLICY_EDF:
+        return SORT_BY_DEADLINE;
+    default:
+        return SORT_BY_PRIORITY;
+    }
+}
+
+// 같은 시각 이벤트의 처리 순서
+// Aging, EDF, RMS는 도착을 모두 처리한 뒤 I/O 완료를 처리하고,
+// 나머지 정책은 프로세스 번호 순서로 도착과 I/O 완료를 섞어서 처리한다
+static int event_order(SchedulingPolicy policy, EventType type) {
+    if (type == EVENT_AGING)
+        return -1;
+    if (type == EVENT_IO_COMPLETE &&
+        (policy == POLICY_PRIORITY_AGING || is_real_time(policy)))
+        return 1;
+    return 0;
+}
+
+static void schedule_keyed(Engine *e, int time, EventType type, int pid,
+                           long key) {
+    Event event;
+    event.time = time;
+    event.order = event_order(e->policy, type);
+    event.pid = pid;
+    event.key = key;
+    event.type = type;
+    push_event(&e->events, event);
+}
+
+static void schedule_event(Engine *e, int time, EventType type, int pid) {
+    schedule_keyed(e, time, type, pid, e->keys ? e->keys[pid] : pid);
+}
+
+// EDF/RMS 태스크 릴리즈 예약 (pid 자리에 태스크 번호)
+static void schedule_release(Engine *e, int time, int task) {
+    schedule_keyed(e, time, EVENT_ARRIVAL, task, task);
+}
+
+static void add_aging_log(Engine *e, int pid, int age, int old_priority,
+                          int new_priority, int preemption) {
+    if (!e->detailed)
+        return;
+
+    SimulationResult *r = e->result;
+    if (r->aging_count == r->aging_capacity) {
+        int capacity = r->aging_capacity ? r->aging_capacity * 2 : 16;
+        r->aging_log = arena_realloc(r->arena, r->aging_log,
+                                     sizeof(AgingLogEntry) * r->aging_capacity,
+                                     sizeof(AgingLogEntry) * capacity);
+        r->aging_capacity = capacity;
+    }
+    AgingLogEntry *entry = &r->aging_log[r->aging_count++];
+    entry->time = e->time;
+    entry->pid = pid;
+    entry->age = age;
+    entry->old_priority = old_priority;
+    entry->new_priority = new_priority;
+    entry->preemption = preemption;
+}
+
+// 슬롯의 실행 상태를 처음 상태로 (배열이 모자라면 두 배로 늘림)
+static void reset_state(Engine *e, int slot) {
+    SchedState *s = e->state;
+    if (slot >= s->capacity) {
+        int capacity = s->capacity * 2;
+        if (capacity <= slot)
+            capacity = slot + 1;
+        grow_sched_state(s, capacity);
+        if (uses_sorted_ready(e->policy)) {
+            for (int i = 0; i < e->ready_count; i++)
+                e->ready[i].sorted.keys = s->key;
+        }
+    }
+
+    s->key[slot] = sort_key(&e->processes[slot], e->criteria);
+    s->progress[slot] = 0;
+    s->io_cursor[slot] = 0;
+    s->ready_since[slot] = 0;
+    s->waiting[slot] = 0;
+    memset(&s->outcome[slot], 0, sizeof(ProcessOutcome));
+    s->stamp[slot] = s->generation;
+    if (e->migration_left)
+        e->migration_left[slot] = 0;
+    if (e->last_core)
+        e->last_core[slot] = -1;
+}
+
+// 이번 실행에서 처음 사용하는 슬롯이면 초기화
+static void touch_state(Engine *e, int slot) {
+    if (slot >= e->state->capacity ||
+        e->state->stamp[slot] != e->state->generation)
+        reset_state(e, slot);
+}
+
+// 코어 c가 꺼내 쓰는 ready queue의 번호
+static int queue_of_core(Engine *e, int core) {
+    return e->partitioned ? core : 0;
+}
+
+// 프로세스가 들어갈 ready queue의 번호
+static int queue_of(Engine *e, int pid) {
+    return e->partitioned ? e->home[pid] : 0;
+}
+
+static int ready_is_empty(Engine *e, int queue) {
+    if (uses_sorted_ready(e->policy))
+        return pq_is_empty(&e->ready[queue].sorted);
+    return is_empty(&e->ready[queue].fifo);
+}
+
+// ready queue에서 꺼내면서 ready에 머문 시간을 대기시간에 한 번에 반영
+static int ready_pop(Engine *e, int queue) {
+    int pid;
+    if (uses_sorted_ready(e->policy))
+        pid = pq_pop(&e->ready[queue].sorted);
+    else
+        pid = dequeue(&e->ready[queue].fifo);
+
+    e->state->waiting[pid] += e->time - e->state->ready_since[pid];
+    return pid;
+}
+
+// ready queue에 넣기 (aging 대상이면 다음 aging 시각 예약)
+static void make_ready(Engine *e, int pid) {
+    ReadyQueue *q = &e->ready[queue_of(e, pid)];
+    e->state->ready_since[pid] = e->time;
+
+    if (uses_sorted_ready(e->policy))
+        pq_push(&q->sorted, pid);
+    else if (enqueue(&q->fifo, pid) != 0) {
+        // 원소를 버리면 결과가 틀어지므로 중단
+        perror("ready queue");
+        exit(1);
+    }
+
+    if (e->policy == POLICY_PRIORITY_AGING && e->state->key[pid] > 1) {
+        e->aging_due[pid] = e->time + AGING_THRESHOLD;
+        schedule_event(e, e->aging_due[pid], EVENT_AGING, pid);
+    }
+}
+
+static void start_running(Engine *e, int core, int pid) {
+    Core *c = &e->cores[core];
+    c->running = pid;
+    c->quantum_used = 0;
+    c->switch_due = 0;
+    c->migration_due = 0;
+    if (e->aging_due)
+        e->aging_due[pid] = -1;
+
+    // 코어에 마지막으로 있던 작업과 다르면 문맥 전환
+    // (I/O에서 돌아온 작업이 그 사이 아무도 쓰지 않은 코어로 가면 전환 없음)
+    if (c->dispatched && c->last_job != pid) {
+        e->result->switches++;
+        c->switch_due = e->switch_cost;
+    }
+    c->dispatched = 1;
+    c->last_job = pid;
+
+    // 다른 코어에서 옮겨 온 작업은 실행 전에 이전 비용을 치름
+    if (e->migration_left) {
+        c->migration_due = e->migration_left[pid];
+        e->migration_left[pid] = 0;
+    }
+    if (e->last_core) {
+        if (e->last_core[pid] != -1 && e->last_core[pid] != core) {
+            e->result->migrations++;
+            c->migration_due += e->migration_cost;
+        }
+        e->last_core[pid] = core;
+    }
+}
+
+// 코어 c의 프로세스를 내리고 pid를 실행
+static void preempt(Engine *e, int core, int pid) {
+    // 이전 비용을 치르는 중에 밀려나면 남은 비용은 다음 실행 때 치름
+    if (e->migration_left)
+        e->migration_left[e->cores[core].running] =
+            e->cores[core].migration_due;
+    make_ready(e, e->cores[core].running);
+    start_running(e, core, pid);
+}
+
+// pid가 실행될 수 있는 코어 중 우선순위가 가장 낮은 프로세스를 실행 중인 코어
+// (빈 코어가 있으면 -1: 선점 없이 dispatch에서 배정)
+static int lowest_priority_core(Engine *e, int pid) {
+    int first = e->partitioned ? e->home[pid] : 0;
+    int last = e->partitioned ? first + 1 : e->core_count;
+    int victim = -1;
+    for (int c = first; c < last; c++) {
+        int running = e->cores[c].running;
+        if (running == -1)
+            return -1;
+        if (victim == -1 ||
+            e->state->key[running] > e->state->key[e->cores[victim].running])
+            victim = c;
+    }
+    return victim;
+}
+
+// global 선점형: ready queue 맨 앞이 실행 중인 가장 낮은 우선순위보다
+// 높으면 교체 (한 시각에 여러 프로세스가 도착해 빈 코어에 먼저 배정된
+// 경우에도 항상 우선순위가 높은 순서대로 코어를 차지하도록)
+// aging이 1이면 aging으로 인한 선점으로 기록
+static void rebalance_global(Engine *e, int aging) {
+    while (!ready_is_empty(e, 0)) {
+        int top = pq_peek(&e->ready[0].sorted);
+        int core = lowest_priority_core(e, top);
+        if (core == -1 ||
+            e->state->key[top] >= e->state->key[e->cores[core].running])
+            return;
+        preempt(e, core, ready_pop(e, 0));
+        if (aging)
+            add_aging_log(e, top, 0, 0, 0, 1);
+    }
+}
+
+// 도착 또는 I/O 완료한 프로세스 처리 (선점형이면 선점 검사)
+static void admit(Engine *e, int pid) {
+    if (is_preemptive(e->policy)) {
+        int core = lowest_priority_core(e, pid);
+        if (core != -1 &&
+            e->state->key[pid] < e->state->key[e->cores[core].running]) {
+            preempt(e, core, pid); // 선점 발생
+            return;
+        }
+    }
+    make_ready(e, pid);
+}
+
+// EDF/RMS 인스턴스 기록에 릴리즈 순서대로 추가 (결과는 완료 시 채움)
+static void record_instance(Engine *e, const Process *instance) {
+    SimulationResult *r = e->result;
+    int index = r->instance_count;
+    if (index == r->instance_capacity) {
+        int capacity = r->instance_capacity ? r->instance_capacity * 2 : 16;
+        r->instances = arena_realloc(r->arena, r->instances,
+                                     sizeof(Process) * r->instance_capacity,
+                                     sizeof(Process) * capacity);
+        r->outcomes = arena_realloc(r->arena, r->outcomes,
+                                    sizeof(ProcessOutcome) *
+                                        r->instance_capacity,
+                                    sizeof(ProcessOutcome) * capacity);
+        r->instance_capacity = capacity;
+    }
+    r->instances[index] = *instance;
+    memset(&r->outcomes[index], 0, sizeof(ProcessOutcome));
+}
+
+static int alloc_slot(Engine *e);
+
+// EDF/RMS 주기 작업의 새 인스턴스 생성
+// 인스턴스는 슬롯 풀에서 받아 완료되면 돌려주므로, 슬롯 수는 동시에
+// 살아 있는 인스턴스 수만큼만 늘어난다
+static int release_instance(Engine *e, int task) {
+    const Process *original = &e->tasks[task];
+    int idx = alloc_slot(e);
+    Process *instance = &e->slots[idx];
+
+    memcpy(instance, original, sizeof(Process));
+    instance->pid = task; // 원본 프로세스와 동일한 PID 유지
+    instance->arrival_time = e->time;
+
+    // 첫 번째 도착인지 주기적 도착인지 확인하여 deadline 설정
+    if (e->time != original->arrival_time) {
+        int period_count = (e->time - original->arrival_time) / original->period;
+        instance->deadline = original->deadline + period_count * original->period;
+    }
+
+    if (e->detailed)
+        record_instance(e, instance);
+    e->keys[idx] = e->result->instance_count++;
+    if (e->partitioned)
+        e->home[idx] = e->task_core[task]; // 태스크 단위로 코어 고정
+    reset_state(e, idx);
+
+    // 다음 도착 예약
+    if (original->period > 0)
+        schedule_release(e, e->time + original->period, task);
+
+    return idx;
+}
+
+// RR: 타임 퀀텀을 다 쓴 프로세스를 ready queue 뒤로 보냄
+static void expire_quantum(Engine *e) {
+    for (int c = 0; c < e->core_count; c++) {
+        Core *core = &e->cores[c];
+        if (core->running != -1 && e->quantum > 0 &&
+            core->quantum_used >= e->quantum) {
+            int rotated = core->running;
+            core->running = -1;
+            make_ready(e, rotated);
+        }
+    }
+}
+
+// aging 대상 정렬 순서 (ready queue 번호, 그 큐 안에서 꺼내질 순서)
+static int compare_ready(Engine *e, int pid1, int pid2) {
+    int q1 = queue_of(e, pid1);
+    int q2 = queue_of(e, pid2);
+    if (q1 != q2)
+        return q1 - q2;
+    return pq_compare(&e->ready[q1].sorted, pid1, pid2);
+}
+
+// Priority with Aging: 임계값에 도달한 프로세스의 우선순위 상승
+static void apply_aging(Engine *e) {
+    int candidate_count = 0;
+
+    while (!is_event_queue_empty(&e->events) &&
+           peek_event(&e->events).type == EVENT_AGING &&
+           peek_event(&e->events).time <= e->time) {
+        Event event = pop_event(&e->events);
+        if (e->aging_due[event.pid] == event.time) {
+            e->aging_due[event.pid] = -1;
+            e->candidates[candidate_count++] = event.pid;
+        }
+    }
+    if (candidate_count == 0)
+        return;
+
+    // ready queue 순서대로 aging 대상 정렬
+    for (int i = 1; i < candidate_count; i++) {
+        int pid = e->candidates[i];
+        int j = i - 1;
+        while (j >= 0 && compare_ready(e, e->candidates[j], pid) > 0) {
+            e->candidates[j + 1] = e->candidates[j];
+            j--;
+        }
+        e->candidates[j + 1] = pid;
+    }
+
+    for (int i = 0; i < candidate_count; i++) {
+        int pid = e->candidates[i];
+        int old_priority = e->state->key[pid];
+        e->state->key[pid]--;
+        pq_update(&e->ready[queue_of(e, pid)].sorted, pid);
+
+        add_aging_log(e, pid, AGING_THRESHOLD, old_priority,
+                      e->state->key[pid], 0);
+
+        if (e->state->key[pid] > 1) {
+            e->aging_due[pid] = e->time + AGING_THRESHOLD;
+            schedule_event(e, e->aging_due[pid], EVENT_AGING, pid);
+        }
+    }
+
+    // 선점 처리 (Aging 후)
+    // global은 도착 때와 같이 가장 낮은 우선순위의 작업을 내리고,
+    // partitioned는 코어마다 자기 ready queue와 비교
+    if (!e->partitioned) {
+        rebalance_global(e, 1);
+        return;
+    }
+    for (int c = 0; c < e->core_count; c++) {
+        int running = e->cores[c].running;
+        int queue = queue_of_core(e, c);
+        if (running == -1 || ready_is_empty(e, queue))
+            continue;
+        int top_ready = pq_peek(&e->ready[queue].sorted);
+        if (e->state->key[top_ready] < e->state->key[running]) {
+            int promoted = ready_pop(e, queue);
+            preempt(e, c, promoted);
+            add_aging_log(e, promoted, 0, 0, 0, 1);
+        }
+    }
+}
+
+// 빈 슬롯 확보 (모자라면 두 배로 늘림)
+static int alloc_slot(Engine *e) {
+    if (e->free_count > 0)
+        return e->free_slots[--e->free_count];
+
+    if (e->count == e->capacity) {
+        Arena *scratch = &e->state->scratch;
+        int old_capacity = e->capacity;
+        e->capacity *= 2;
+        e->slots = arena_realloc(scratch, e->slots,
+                                 sizeof(Process) * old_capacity,
+                                 sizeof(Process) * e->capacity);
+        e->processes = e->slots;
+        e->keys = arena_realloc(scratch, e->keys, sizeof(long) * old_capacity,
+                                sizeof(long) * e->capacity);
+        e->free_slots =
+            arena_realloc(scratch, e->free_slots, sizeof(int) * old_capacity,
+                          sizeof(int) * e->capacity);
+        if (e->slot_io) {
+            e->slot_io = arena_realloc(scratch, e->slot_io,
+                                       sizeof(IOArena) * old_capacity,
+                                       sizeof(IOArena) * e->capacity);
+            for (int i = old_capacity; i < e->capacity; i++)
+                init_io_arena(&e->slot_io[i], 0);
+        }
+        if (e->aging_due) {
+            e->aging_due =
+                arena_realloc(scratch, e->aging_due,
+                              sizeof(int) * old_capacity,
+                              sizeof(int) * e->capacity);
+            e->candidates =
+                arena_realloc(scratch, e->candidates,
+                              sizeof(int) * old_capacity,
+                              sizeof(int) * e->capacity);
+            for (int i = old_capacity; i < e->capacity; i++)
+                e->aging_due[i] = -1;
+        }
+        if (e->home) {
+            e->home = arena_realloc(scratch, e->home,
+                                    sizeof(int) * old_capacity,
+                                    sizeof(int) * e->capacity);
+        }
+        if (e->migration_left) {
+            e->migration_left = arena_realloc(scratch, e->migration_left,
+                                              sizeof(int) * old_capacity,
+                                              sizeof(int) * e->capacity);
+        }
+        if (e->last_core) {
+            e->last_core = arena_realloc(scratch, e->last_core,
+                                         sizeof(int) * old_capacity,
+                                         sizeof(int) * e->capacity);
+        }
+        if (e->io_until) {
+            e->io_until = arena_realloc(scratch, e->io_until,
+                                        sizeof(int) * old_capacity,
+                                        sizeof(int) * e->capacity);
+            for (int i = old_capacity; i < e->capacity; i++)
+                e->io_until[i] = -1;
+        }
+    }
+    return e->count++;
+}
+
+// 스트리밍: 다음 프로세스를 읽어 도착 이벤트 예약
+// 도착 이벤트가 처리될 때마다 하나씩 읽으므로 미리 읽어 두는 것은 한 개뿐
+static void feed_arrival(Engine *e) {
+    if (e->source_done)
+        return;
+
+    int slot = alloc_slot(e);
+    Process *p = &e->slots[slot];
+    int status = read_workload_process(e->source, p);
+
+    if (status == 1 && p->arrival_time < e->last_arrival) {
+        printf("%s: process %d arrives at %d, before the previous arrival "
+               "(%d); streamed traces must be sorted by arrival time\n",
+               e->source->path, p->pid, p->arrival_time, e->last_arrival);
+        status = -1;
+    }
+    if (status != 1) {
+        e->free_slots[e->free_count++] = slot;
+        e->source_done = 1;
+        e->source_error = status < 0;
+        return;
+    }
+
+    // 리더가 돌려준 I/O는 다음 읽기 전까지만 유효하므로 슬롯 배열로 복사
+    e->slot_io[slot].count = 0;
+    append_io_operations(&e->slot_io[slot], p->io_operations, p->io_count);
+    p->io_operations = e->slot_io[slot].ops;
+
+    reset_state(e, slot);
+
+    e->last_arrival = p->arrival_time;
+    e->keys[slot] = e->next_key++;
+    e->live++;
+    schedule_event(e, p->arrival_time, EVENT_ARRIVAL, slot);
+}
+
+// 현재 시각에 발생한 도착 / I/O 완료 이벤트 처리
+static void process_events(Engine *e) {
+    while (!is_event_queue_empty(&e->events) &&
+           peek_event(&e->events).time <= e->time) {
+        Event event = pop_event(&e->events);
+
+        switch (event.type) {
+        case EVENT_ARRIVAL:
+            if (is_real_time(e->policy)) {
+                admit(e, release_instance(e, event.pid));
+            } else {
+                if (!e->source)
+                    touch_state(e, event.pid);
+                if (e->partitioned) {
+                    // 도착 순서대로 코어를 돌아가며 배정
+                    e->home[event.pid] = e->next_core;
+                    e->next_core = (e->next_core + 1) % e->core_count;
+                }
+                admit(e, event.pid);
+                if (e->source)
+                    feed_arrival(e);
+            }
+            break;
+        case EVENT_IO_COMPLETE:
+            if (e->io_until)
+                e->io_until[event.pid] = -1;
+            admit(e, event.pid);
+            break;
+        default:
+            break; // 이미 처리된 aging 이벤트
+        }
+    }
+}
+
+static int ready_length(Engine *e, int queue) {
+    if (uses_sorted_ready(e->policy))
+        return e->ready[queue].sorted.count;
+    return e->ready[queue].fifo.count;
+}
+
+// ready queue의 i번째 원소 (정렬 큐는 힙 배열 순서)
+static int ready_at(Engine *e, int queue, int i) {
+    if (uses_sorted_ready(e->policy))
+        return e->ready[queue].sorted.heap[i];
+    Queue *fifo = &e->ready[queue].fifo;
+    return fifo->data[(fifo->front + i) % fifo->capacity];
+}
+
+// 작업 하나를 고르는 훔치기 방식에서 a가 b보다 먼저 뽑히는지
+// 동점이면 원래 코어에서 먼저 꺼내질 작업을 고른다
+static int steal_before(Engine *e, int queue, int a, int b) {
+    SchedState *s = e->state;
+    if (e->steal == STEAL_SHORTEST) {
+        int left_a = e->processes[a].cpu_burst - s->progress[a];
+        int left_b = e->processes[b].cpu_burst - s->progress[b];
+        if (left_a != left_b)
+            return left_a < left_b;
+    }
+    if (s->ready_since[a] != s->ready_since[b])
+        return s->ready_since[a] < s->ready_since[b];
+    if (uses_sorted_ready(e->policy))
+        return pq_compare(&e->ready[queue].sorted, a, b) < 0;
+    return 0; // FIFO는 앞에서부터 보므로 먼저 본 쪽을 유지
+}
+
+// 훔칠 작업을 큐에서 빼냄 (대기 시간은 아직 반영하지 않음)
+static int take_steal_candidate(Engine *e, int queue) {
+    if (e->steal == STEAL_HALF) {
+        // 원래 코어에서 먼저 실행될 작업부터
+        if (uses_sorted_ready(e->policy))
+            return pq_pop(&e->ready[queue].sorted);
+        return dequeue(&e->ready[queue].fifo);
+    }
+
+    int best = 0;
+    for (int i = 1; i < ready_length(e, queue); i++) {
+        if (steal_before(e, queue, ready_at(e, queue, i),
+                         ready_at(e, queue, best)))
+            best = i;
+    }
+    int pid = ready_at(e, queue, best);
+    if (uses_sorted_ready(e->policy))
+        pq_remove(&e->ready[queue].sorted, pid);
+    else
+        queue_remove_at(&e->ready[queue].fifo, best);
+    return pid;
+}
+
+// 할 일이 없는 코어가 ready queue가 가장 긴 코어에서 작업을 가져옴
+// 가져온 작업은 이 코어에 배정되고, 옮겨진 횟수만큼의 이전 비용을
+// 다음 실행을 시작할 때 치른다
+// 첫 작업은 바로 실행하고 (STEAL_HALF의) 나머지는 이 코어의 큐에 넣는다
+static void steal_work(Engine *e, int thief) {
+    int victim = -1;
+    for (int q = 0; q < e->ready_count; q++) {
+        if (q != thief && ready_length(e, q) > 0 &&
+            (victim == -1 || ready_length(e, q) > ready_length(e, victim)))
+            victim = q;
+    }
+    if (victim == -1)
+        return;
+
+    int moves = e->steal == STEAL_HALF ? (ready_length(e, victim) + 1) / 2 : 1;
+    e->result->steals++;
+    for (int i = 0; i < moves; i++) {
+        int pid = take_steal_candidate(e, victim);
+        e->home[pid] = thief;
+        e->migration_left[pid] += e->migration_cost;
+        e->result->migrations++;
+
+        if (i == 0) {
+            e->state->waiting[pid] += e->time - e->state->ready_since[pid];
+            start_running(e, thief, pid);
+        } else if (uses_sorted_ready(e->policy)) {
+            pq_push(&e->ready[thief].sorted, pid); // ready_since는 그대로
+        } else if (enqueue(&e->ready[thief].fifo, pid) != 0) {
+            perror("ready queue");
+            exit(1);
+        }
+    }
+}
+
+// CPU 스케줄링 (Ready → Running): 빈 코어마다 자기 ready queue에서 꺼냄
+// 작업 훔치기를 쓰면 그래도 비어 있는 코어가 다른 코어의 큐에서 가져온다
+static void dispatch(Engine *e) {
+    for (int c = 0; c < e->core_count; c++) {
+        int queue = queue_of_core(e, c);
+        if (e->cores[c].running == -1 && !ready_is_empty(e, queue))
+            start_running(e, c, ready_pop(e, queue));
+    }
+
+    if (e->steal != STEAL_NONE) {
+        for (int c = 0; c < e->core_count; c++) {
+            if (e->cores[c].running == -1)
+                steal_work(e, c);
+        }
+    }
+
+    if (e->core_count > 1 && !e->partitioned && is_preemptive(e->policy))
+        rebalance_global(e, 0);
+}
+
+// 시뮬레이션이 끝날 때 ready queue에 남은 프로세스의 대기시간 반영
+static void flush_waiting(Engine *e) {
+    SchedState *s = e->state;
+    for (int q = 0; q < e->ready_count; q++) {
+        if (uses_sorted_ready(e->policy)) {
+            PriorityQueue *pq = &e->ready[q].sorted;
+            for (int i = 0; i < pq->count; i++) {
+                int pid = pq->heap[i];
+                s->waiting[pid] += e->time - s->ready_since[pid];
+            }
+            continue;
+        }
+        Queue *fifo = &e->ready[q].fifo;
+        for (int i = fifo->front, cnt = 0; cnt < fifo->count;
+             cnt++, i = (i + 1) % fifo->capacity) {
+            int pid = fifo->data[i];
+            s->waiting[pid] += e->time - s->ready_since[pid];
+        }
+    }
+}
+
+static void add_deadline_miss(Engine *e, int core, const Process *p,
+                              int comp_time) {
+    SimulationResult *r = e->result;
+    if (r->core_misses)
+        r->core_misses[core]++;
+    if (e->detailed) {
+        if (r->miss_count == r->miss_capacity) {
+            int capacity = r->miss_capacity ? r->miss_capacity * 2 : 16;
+            r->misses = arena_realloc(
+                r->arena, r->misses,
+                sizeof(DeadlineMissInfo) * r->miss_capacity,
+                sizeof(DeadlineMissInfo) * capacity);
+            r->miss_capacity = capacity;
+        }
+        DeadlineMissInfo *miss = &r->misses[r->miss_count];
+        miss->pid = p->pid;
+        miss->absolute_deadline = p->deadline;
+        miss->completion_time = comp_time;
+    }
+    r->miss_count++;
+}
+
+static void finish_running(Engine *e, int core) {
+    int pid = e->cores[core].running;
+    const Process *p = &e->processes[pid];
+    ProcessOutcome *o = &e->state->outcome[pid];
+
+    o->comp_time = e->time;
+    o->turnaround_time = o->comp_time - p->arrival_time;
+    o->waiting_time = e->state->waiting[pid];
+    e->completed++;
+
+    SimulationResult *r = e->result;
+    r->completed++;
+    r->total_waiting += o->waiting_time;
+    r->total_turnaround += o->turnaround_time;
+    r->total_response += o->response_time;
+
+    // 데드라인 미스 체크
+    if (is_real_time(e->policy) && o->comp_time > p->deadline) {
+        add_deadline_miss(e, core, p, o->comp_time);
+        o->missed_deadline = 1;
+    }
+
+    // 스트리밍, EDF/RMS: 완료된 프로세스의 슬롯 반환
+    if (e->source || is_real_time(e->policy)) {
+        if (is_real_time(e->policy) && e->detailed)
+            r->outcomes[e->keys[pid]] = *o;
+        e->free_slots[e->free_count++] = pid;
+    }
+    if (e->source)
+        e->live--;
+
+    e->cores[core].running = -1;
+    e->cores[core].last_job = -1; // 슬롯이 재사용되어도 같은 작업으로 보지 않음
+}
+
+// 코어 c의 간트차트 (단일 CPU는 result->gantt)
+static GanttChart *core_gantt(Engine *e, int core) {
+    if (e->core_count == 1)
+        return &e->result->gantt;
+    return &e->result->core_gantt[core];
+}
+
+// 코어 c에서 실행 중인 프로세스가 멈추지 않고 실행할 수 있는 길이
+// (다음 I/O 시작 지점, 버스트 완료 지점, RR 타임 퀀텀 만료 중 가장 가까운 곳)
+// 전환/이전 비용이 남아 있으면 그 비용을 다 쓰는 지점까지
+static int run_span(Engine *e, int core) {
+    const Core *c = &e->cores[core];
+    if (c->switch_due > 0)
+        return c->switch_due;
+    if (c->migration_due > 0)
+        return c->migration_due;
+
+    const Process *p = &e->processes[c->running];
+    int progress = e->state->progress[c->running];
+
+    int stop = p->cpu_burst;
+    int next_io = next_io_start(p, progress, &e->state->io_cursor[c->running]);
+    if (next_io != -1 && next_io < stop)
+        stop = next_io;
+
+    int span = stop - progress;
+    if (span < 1)
+        span = 1;
+    if (e->policy == POLICY_RR && e->quantum > 0 &&
+        e->quantum - c->quantum_used < span)
+        span = e->quantum - c->quantum_used;
+    return span;
+}
+
+// 코어 c에서 실행 중인 프로세스를 span만큼 진행 (e->time은 구간 시작 시각)
+static void run_core(Engine *e, int core, int span) {
+    Core *c = &e->cores[core];
+    int pid = c->running;
+    const Process *p = &e->processes[pid];
+
+    // Gantt 차트에는 실제 PID를 사용
+    int gantt_pid = is_real_time(e->policy) ? p->pid : pid;
+    c->busy_time += span;
+    c->overhead = c->switch_due > 0 || c->migration_due > 0;
+    if (c->overhead) {
+        // 전환/이전 비용: 코어는 쓰지만 작업은 진행하지 않음
+        GanttStatus status = GANTT_SWITCH;
+        if (c->switch_due > 0) {
+            c->switch_due -= span;
+        } else {
+            status = GANTT_MIGRATION;
+            c->migration_due -= span;
+        }
+        if (e->detailed)
+            add_gantt_entry(core_gantt(e, core), e->time, e->time + span,
+                            gantt_pid, status);
+        e->result->overhead_time += span;
+        return;
+    }
+
+    if (e->detailed)
+        add_gantt_entry(core_gantt(e, core), e->time, e->time + span,
+                        gantt_pid, GANTT_RUN);
+
+    int *progress = &e->state->progress[pid];
+    if (*progress == 0)
+        e->state->outcome[pid].response_time = e->time - p->arrival_time;
+    *progress += span;
+    if (e->criteria == SORT_BY_REMAINING_TIME)
+        e->state->key[pid] = p->cpu_burst - *progress;
+    c->quantum_used += span;
+}
+
+// 진행을 마친 코어에서 I/O 시작 또는 버스트 완료 처리
+static void end_span(Engine *e, int core) {
+    int pid = e->cores[core].running;
+    const Process *p = &e->processes[pid];
+    int progress = e->state->progress[pid];
+
+    // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
+    int io_burst;
+    if (take_io_at_progress(p, progress, &e->state->io_cursor[pid],
+                            &io_burst)) {
+        schedule_event(e, e->time + io_burst, EVENT_IO_COMPLETE, pid);
+        if (e->io_until)
+            e->io_until[pid] = e->time + io_burst;
+        e->cores[core].running = -1;
+    } else if (progress >= p->cpu_burst) {
+        finish_running(e, core);
+    }
+}
+
+// 다음 이벤트 또는 실행 중인 프로세스의 경계까지 시간을 한 번에 진행
+// 코어가 여럿이면 가장 먼저 경계에 닿는 코어까지 모든 코어를 함께 진행한다
+static int advance(Engine *e) {
+    int end = INT_MAX;
+    if (!is_event_queue_empty(&e->events))
+        end = peek_event(&e->events).time;
+    if (is_real_time(e->policy) && end > e->max_time)
+        end = e->max_time;
+
+    int span = INT_MAX;
+    for (int c = 0; c < e->core_count; c++) {
+        if (e->cores[c].running == -1)
+            continue;
+        int s = run_span(e, c);
+        if (s < span)
+            span = s;
+    }
+
+    if (span == INT_MAX) {
+        if (end == INT_MAX)
+            return 0; // 더 이상 도착할 프로세스가 없음
+        span = end - e->time;
+    } else if (end - e->time < span) {
+        span = end - e->time;
+    }
+
+    for (int c = 0; c < e->core_count; c++) {
+        if (e->cores[c].running != -1) {
+            run_core(e, c, span);
+            continue;
+        }
+        if (e->detailed)
+            add_gantt_entry(core_gantt(e, c), e->time, e->time + span, -1,
+                            GANTT_IDLE);
+        e->idle_time += span;
+    }
+    e->time += span;
+
+    for (int c = 0; c < e->core_count; c++) {
+        if (e->cores[c].running != -1 && !e->cores[c].overhead)
+            end_span(e, c);
+    }
+    return 1;
+}
+
+static void init_engine(Engine *e, SchedulingPolicy policy, int quantum,
+                        int max_time, SimulationResult *result) {
+    memset(e, 0, sizeof(Engine));
+    memset(result, 0, sizeof(SimulationResult));
+
+    e->policy = policy;
+    e->quantum = quantum;
+    e->max_time = max_time;
+    e->criteria = policy_criteria(policy);
+    e->core_count = 1;
+    e->result = result;
+    result->core_count = 1;
+    result->steady_from = -1;
+}
+
+// 실행 상태 연결 후 새 실행 시작 (capacity: 예상 프로세스 수)
+// 이전 실행이 state의 scratch에 남긴 버퍼는 여기서 모두 회수된다
+static void begin_run(Engine *e, SchedState *state, int capacity) {
+    e->state = state;
+    begin_sched_run(state);
+    grow_sched_state(state, capacity);
+}
+
+// 코어 준비 (cpu가 NULL이면 단일 CPU)
+// 코어가 둘 이상이면 코어별 간트차트와 실행 시간도 결과에 남긴다
+static void init_cores(Engine *e, const CpuConfig *cpu, int capacity) {
+    Arena *scratch = &e->state->scratch;
+    SimulationResult *r = e->result;
+
+    if (cpu && cpu->cores > 1) {
+        e->core_count = cpu->cores;
+        e->partitioned = cpu->dispatch == DISPATCH_PARTITIONED;
+    }
+    e->cores = arena_alloc(scratch, sizeof(Core) * e->core_count);
+    memset(e->cores, 0, sizeof(Core) * e->core_count);
+    for (int c = 0; c < e->core_count; c++) {
+        e->cores[c].running = -1;
+        e->cores[c].last_job = -1;
+    }
+    if (cpu) {
+        e->switch_cost = cpu->switch_cost;
+        e->migration_cost = cpu->migration_cost;
+    }
+    if (e->partitioned) {
+        e->home = arena_alloc(scratch, sizeof(int) * capacity);
+        e->steal = cpu->steal;
+    } else if (e->core_count > 1) {
+        // global: 선점된 작업이 다른 코어에서 다시 실행되면 이전
+        e->last_core = arena_alloc(scratch, sizeof(int) * capacity);
+        for (int i = 0; i < capacity; i++)
+            e->last_core[i] = -1;
+    }
+    if (e->steal != STEAL_NONE || e->last_core) {
+        e->migration_left = arena_alloc(scratch, sizeof(int) * capacity);
+        memset(e->migration_left, 0, sizeof(int) * capacity);
+    }
+
+    r->core_count = e->core_count;
+    if (e->core_count == 1) {
+        if (e->detailed)
+            init_gantt_chart(&r->gantt, capacity * 2, scratch);
+        return;
+    }
+
+    r->core_busy = arena_alloc(scratch, sizeof(int) * e->core_count);
+    r->core_misses = arena_alloc(scratch, sizeof(int) * e->core_count);
+    memset(r->core_misses, 0, sizeof(int) * e->core_count);
+    if (e->detailed) {
+        int lane_capacity = capacity * 2 / e->core_count + 1;
+        r->core_gantt =
+            arena_alloc(scratch, sizeof(GanttChart) * e->core_count);
+        for (int c = 0; c < e->core_count; c++)
+            init_gantt_chart(&r->core_gantt[c], lane_capacity, scratch);
+    }
+}
+
+// 이벤트 큐와 ready queue 준비 (capacity: 예상 프로세스 수)
+// 버퍼는 모두 state의 scratch arena에서 할당한다
+static void init_queues(Engine *e, int capacity) {
+    Arena *scratch = &e->state->scratch;
+    init_event_queue(&e->events, capacity * 2, scratch);
+
+    // partitioned면 코어마다 큐를 두고, 크기는 코어 수로 나눠 시작
+    e->ready_count = e->partitioned ? e->core_count : 1;
+    int queue_capacity = capacity / e->ready_count + 1;
+    e->ready = arena_alloc(scratch, sizeof(ReadyQueue) * e->ready_count);
+    for (int i = 0; i < e->ready_count; i++) {
+        init_queue_with_capacity(&e->ready[i].fifo, queue_capacity, scratch);
+        if (uses_sorted_ready(e->policy))
+            init_priority_queue(&e->ready[i].sorted, e->state->key,
+                                queue_capacity, scratch);
+    }
+
+    if (e->policy == POLICY_PRIORITY_AGING) {
+        e->aging_due = arena_alloc(scratch, sizeof(int) * capacity);
+        e->candidates = arena_alloc(scratch, sizeof(int) * capacity);
+        for (int i = 0; i < capacity; i++)
+            e->aging_due[i] = -1;
+    }
+}
+
+static int engine_finished(Engine *e) {
+    if (is_real_time(e->policy))
+        return e->time >= e->max_time;
+    if (e->source)
+        return e->source_error || (e->source_done && e->live == 0);
+    return e->completed >= e->count;
+}
+
+// 종료 조건까지 진행 (EDF/RMS는 max_time까지)
+static void run_steps(Engine *e) {
+    while (!engine_finished(e)) {
+        if (e->policy == POLICY_RR)
+            expire_quantum(e);
+        if (e->policy == POLICY_PRIORITY_AGING)
+            apply_aging(e);
+
+        process_events(e);
+        dispatch(e);
+
+        if (!advance(e))
+            break;
+    }
+}
+
+static void finish_engine(Engine *e) {
+    flush_waiting(e);
+
+    e->result->total_time = e->time;
+    e->result->idle_time = e->idle_time;
+    if (e->result->core_busy) {
+        for (int c = 0; c < e->core_count; c++)
+            e->result->core_busy[c] = e->cores[c].busy_time;
+    }
+}
+
+static void run_engine(Engine *e) {
+    run_steps(e);
+    finish_engine(e);
+}
+
+// 정상 상태 탐지에 쓰는 작업 인스턴스 하나의 상태
+// 시각은 모두 하이퍼피리어드 경계 기준 상대값이라 경계마다 그대로 비교할 수 있다
+typedef struct {
+    long order;      // 릴리즈 순서 (정렬에만 쓰고 비교 전에 지움)
+    int task;
+    int progress;
+    int io_cursor;
+    int waiting;     // 지금까지 누적된 대기 시간
+    int arrival;
+    int deadline;
+    int status;      // 0: 실행 중, 1: ready, 2: I/O
+    int detail;      // ready: 꺼내질 순서, I/O: 완료 시각
+    int ready_since; // ready: 들어간 시각
+} JobSnapshot;
+
+// ready 작업의 꺼내질 순서 계산용 (정렬 키, 동점 처리 순번)
+typedef struct {
+    int key;
+    long sequence;
+    int job; // JobSnapshot 인덱스
+} ReadyRank;
+
+typedef struct {
+    JobSnapshot *jobs;
+    int count;
+    int capacity;
+    ReadyRank *ranks;
+    int rank_capacity;
+
+    // 경계 시점의 누적 합계 (반복 한 번의 증가량 계산용)
+    int instance_count;
+    int completed;
+    int miss_count;
+    int idle_time;
+    int switches;
+    long long total_waiting;
+    long long total_turnaround;
+    long long total_response;
+
+    // 코어의 문맥 전환 판정 상태 (작업을 올린 적이 있는지, 마지막으로
+    // 올린 작업의 jobs 인덱스, -1: 없음)
+    int dispatched;
+    int last_job;
+} SteadySnapshot;
+
+static int compare_job_order(const void *a, const void *b) {
+    const JobSnapshot *x = (const JobSnapshot *)a;
+    const JobSnapshot *y = (const JobSnapshot *)b;
+    return (x->order > y->order) - (x->order < y->order);
+}
+
+static int compare_ready_rank(const void *a, const void *b) {
+    const ReadyRank *x = (const ReadyRank *)a;
+    const ReadyRank *y = (const ReadyRank *)b;
+    if (x->key != y->key)
+        return x->key < y->key ? -1 : 1;
+    return (x->sequence > y->sequence) - (x->sequence < y->sequence);
+}
+
+static JobSnapshot *add_job_snapshot(Engine *e, SteadySnapshot *snap,
+                                     int slot, int boundary, int status) {
+    if (snap->count == snap->capacity) {
+        int capacity = snap->capacity ? snap->capacity * 2 : 16;
+        snap->jobs = arena_realloc(&e->state->scratch, snap->jobs,
+                                   sizeof(JobSnapshot) * snap->capacity,
+                                   sizeof(JobSnapshot) * capacity);
+        snap->capacity = capacity;
+    }
+
+    const Process *p = &e->processes[slot];
+    JobSnapshot *job = &snap->jobs[snap->count++];
+    memset(job, 0, sizeof(JobSnapshot)); // memcmp로 비교하므로 패딩까지 지움
+    job->order = e->keys[slot];
+    job->task = p->pid;
+    job->progress = e->state->progress[slot];
+    job->io_cursor = e->state->io_cursor[slot];
+    job->waiting = e->state->waiting[slot];
+    job->arrival = p->arrival_time - boundary;
+    job->deadline = p->deadline - boundary;
+    job->status = status;
+    return job;
+}
+
+// 경계 시각의 상태 기록 (경계 시각의 이벤트는 아직 처리하지 않은 상태)
+// 릴리즈 시점은 경계마다 위상이 같으므로 살아 있는 인스턴스만 보면 된다
+static void take_snapshot(Engine *e, int boundary, SteadySnapshot *snap) {
+    SimulationResult *r = e->result;
+    snap->count = 0;
+
+    // 단일 CPU에서만 사용
+    if (e->cores[0].running != -1)
+        add_job_snapshot(e, snap, e->cores[0].running, boundary, 0);
+
+    // ready 작업은 힙 배열 위치 대신 꺼내질 순서를 기록
+    PriorityQueue *pq = &e->ready[0].sorted;
+    if (pq->count > snap->rank_capacity) {
+        snap->ranks = arena_realloc(&e->state->scratch, snap->ranks,
+                                    sizeof(ReadyRank) * snap->rank_capacity,
+                                    sizeof(ReadyRank) * pq->count);
+        snap->rank_capacity = pq->count;
+    }
+    for (int i = 0; i < pq->count; i++) {
+        int slot = pq->heap[i];
+        snap->ranks[i].key = pq->keys[slot];
+        snap->ranks[i].sequence = pq->sequence[slot];
+        snap->ranks[i].job = snap->count;
+        JobSnapshot *job = add_job_snapshot(e, snap, slot, boundary, 1);
+        job->ready_since = e->state->ready_since[slot] - boundary;
+    }
+    if (pq->count > 1)
+        qsort(snap->ranks, pq->count, sizeof(ReadyRank), compare_ready_rank);
+    for (int i = 0; i < pq->count; i++)
+        snap->jobs[snap->ranks[i].job].detail = i;
+
+    for (int slot = 0; slot < e->count; slot++) {
+        if (e->io_until[slot] == -1)
+            continue;
+        JobSnapshot *job = add_job_snapshot(e, snap, slot, boundary, 2);
+        job->detail = e->io_until[slot] - boundary;
+    }
+
+    // 릴리즈 순서로 정렬하면 순번 자체는 필요 없음
+    if (snap->count > 1)
+        qsort(snap->jobs, snap->count, sizeof(JobSnapshot), compare_job_order);
+    int last_job = e->cores[0].last_job;
+    snap->dispatched = e->cores[0].dispatched;
+    snap->last_job = -1;
+    for (int i = 0; i < snap->count; i++) {
+        if (last_job != -1 && snap->jobs[i].order == e->keys[last_job])
+            snap->last_job = i;
+        snap->jobs[i].order = 0;
+    }
+
+    snap->instance_count = r->instance_count;
+    snap->completed = r->completed;
+    snap->miss_count = r->miss_count;
+    snap->idle_time = e->idle_time;
+    snap->switches = r->switches;
+    snap->total_waiting = r->total_waiting;
+    snap->total_turnaround = r->total_turnaround;
+    snap->total_response = r->total_response;
+}
+
+static int same_snapshot(SteadySnapshot *a, SteadySnapshot *b) {
+    if (a->count != b->count || a->dispatched != b->dispatched ||
+        a->last_job != b->last_job)
+        return 0;
+    return a->count == 0 ||
+           memcmp(a->jobs, b->jobs, sizeof(JobSnapshot) * a->count) == 0;
+}
+
+static long gcd(long a, long b) {
+    while (b != 0) {
+        long t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// 주기의 최소공배수 (주기가 없는 태스크가 있거나 int를 넘으면 -1)
+static int hyperperiod(const Process *tasks, int count) {
+    long lcm = 1;
+    for (int i = 0; i < count; i++) {
+        if (tasks[i].period <= 0)
+            return -1;
+        lcm = lcm / gcd(lcm, tasks[i].period) * tasks[i].period;
+        if (lcm > INT_MAX)
+            return -1;
+    }
+    return (int)lcm;
+}
+
+// EDF/RMS: 마지막 도착 이후 하이퍼피리어드 경계마다 상태를 기록하고,
+// 직전 경계와 같아지면 그 뒤로는 같은 스케줄이 반복되므로
+// 남은 하이퍼피리어드 수만큼 합계를 외삽하고 끝의 자투리만 시뮬레이션한다
+// 반복이 없으면 (과부하로 밀린 작업이 계속 늘어나는 경우 등) 끝까지 진행
+static void run_steady_state(Engine *e) {
+    SimulationResult *r = e->result;
+    int horizon = e->max_time;
+    int period = hyperperiod(e->tasks, e->task_count);
+
+    int offset = 0;
+    for (int i = 0; i < e->task_count; i++) {
+        if (e->tasks[i].arrival_time > offset)
+            offset = e->tasks[i].arrival_time;
+    }
+    if (period <= 0 || (long)offset + 2L * period > horizon) {
+        run_engine(e);
+        return;
+    }
+
+    Arena *scratch = &e->state->scratch;
+    e->io_until = arena_alloc(scratch, sizeof(int) * e->capacity);
+    for (int i = 0; i < e->capacity; i++)
+        e->io_until[i] = -1;
+
+    SteadySnapshot snaps[2];
+    memset(snaps, 0, sizeof(snaps));
+    SteadySnapshot *prev = &snaps[0];
+    SteadySnapshot *cur = &snaps[1];
+
+    int boundary = offset;
+    for (int k = 0; k <= STEADY_STATE_MAX_PERIODS; k++) {
+        e->max_time = boundary;
+        run_steps(e);
+        take_snapshot(e, boundary, cur);
+
+        if (k > 0 && same_snapshot(prev, cur)) {
+            long long cycles = (horizon - boundary) / period;
+            e->max_time = boundary + (horizon - boundary) % period;
+            run_steps(e);
+            finish_engine(e);
+
+            r->instance_count +=
+                (int)(cycles * (cur->instance_count - prev->instance_count));
+            r->completed += (int)(cycles * (cur->completed - prev->completed));
+            r->miss_count +=
+                (int)(cycles * (cur->miss_count - prev->miss_count));
+            r->idle_time += (int)(cycles * (cur->idle_time - prev->idle_time));
+            r->switches += (int)(cycles * (cur->switches - prev->switches));
+            r->total_waiting +=
+                cycles * (cur->total_waiting - prev->total_waiting);
+            r->total_turnaround +=
+                cycles * (cur->total_turnaround - prev->total_turnaround);
+            r->total_response +=
+                cycles * (cur->total_response - prev->total_response);
+            r->total_time = horizon;
+            r->steady_from = boundary - period;
+            r->hyperperiod = period;
+            return;
+        }
+
+        SteadySnapshot *temp = prev;
+        prev = cur;
+        cur = temp;
+        if (horizon - boundary < period)
+            break;
+        boundary += period;
+    }
+
+    e->max_time = horizon;
+    run_engine(e);
+}
+
+static void free_queues(Engine *e) {
+    free_event_queue(&e->events);
+    for (int i = 0; i < e->ready_count; i++) {
+        free_queue(&e->ready[i].fifo);
+        if (uses_sorted_ready(e->policy))
+            free_priority_queue(&e->ready[i].sorted);
+    }
+    arena_free(&e->state->scratch, e->aging_due);
+    arena_free(&e->state->scratch, e->candidates);
+}
+
+// max_time까지 릴리즈될 EDF/RMS 인스턴스 수 (인스턴스 기록의 초기 크기)
+static long expected_releases(const Process *tasks, int count, int max_time) {
+    long total = 0;
+    for (int i = 0; i < count; i++) {
+        const Process *t = &tasks[i];
+        if (t->arrival_time >= max_time)
+            continue;
+        if (t->period > 0)
+            total += ((long)max_time - t->arrival_time + t->period - 1) /
+                     t->period;
+        else
+            total++;
+    }
+    return total;
+}
+
+// EDF/RMS 인스턴스 슬롯 풀 준비 (처음에는 태스크당 하나)
+// partitioned EDF/RMS: 태스크를 코어에 나눔 (코어마다 같은 방식으로 검사)
+static void init_task_cores(Engine *e, PartitionFit fit) {
+    int count = e->task_count > 0 ? e->task_count : 1;
+    e->task_core = arena_alloc(&e->state->scratch, sizeof(int) * count);
+    partition_tasks(e->tasks, e->task_count, e->core_count, fit,
+                    e->policy == POLICY_RMS ? CORE_TEST_RMS : CORE_TEST_EDF,
+                    e->task_core);
+}
+
+static void init_instance_pool(Engine *e, const Process *tasks, int count) {
+    Arena *scratch = &e->state->scratch;
+    e->tasks = tasks;
+    e->task_count = count;
+    e->capacity = count;
+    e->slots = arena_alloc(scratch, sizeof(Process) * e->capacity);
+    e->processes = e->slots;
+    e->keys = arena_alloc(scratch, sizeof(long) * e->capacity);
+    e->free_slots = arena_alloc(scratch, sizeof(int) * e->capacity);
+    e->count = 0;
+
+    if (e->detailed) {
+        // 릴리즈 수를 알 수 있으므로 기록은 한 번에 잡는다
+        // (int 범위를 넘으면 작게 시작해서 늘림)
+        SimulationResult *r = e->result;
+        long releases = expected_releases(tasks, count, e->max_time);
+        int capacity = releases > 0 && releases <= INT_MAX / 2
+                           ? (int)releases
+                           : 16;
+        r->instances = arena_alloc(scratch, sizeof(Process) * capacity);
+        r->outcomes = arena_alloc(scratch, sizeof(ProcessOutcome) * capacity);
+        r->instance_capacity = capacity;
+    }
+}
+
+void simulate(SchedulingPolicy policy, const Process *processes, int count,
+              int quantum, int max_time, int flags, const CpuConfig *cpu,
+              SchedState *state, SimulationResult *result) {
+    int detailed = (flags & SIM_DETAILED) != 0;
+    Engine e;
+    init_engine(&e, policy, quantum, max_time, result);
+    begin_run(&e, state, count);
+    e.detailed = detailed;
+
+    // 결과 버퍼도 scratch에서 할당 (state를 다시 쓰기 전까지 유효)
+    Arena *scratch = &state->scratch;
+    result->arena = scratch;
+
+    if (is_real_time(policy)) {
+        init_instance_pool(&e, processes, count);
+    } else {
+        e.processes = processes;
+        e.count = count;
+    }
+
+    // 슬롯 상태는 도착할 때 초기화 (EDF/RMS는 인스턴스를 릴리즈할 때)
+    init_cores(&e, cpu, count);
+    init_queues(&e, count);
+    if (is_real_time(policy) && e.partitioned)
+        init_task_cores(&e, cpu->partition);
+
+    // 초기 도착 예약 (EDF/RMS는 이후 주기 도착을 릴리즈 시점에 예약)
+    for (int i = 0; i < count; i++) {
+        if (is_real_time(policy))
+            schedule_release(&e, processes[i].arrival_time, i);
+        else
+            schedule_event(&e, processes[i].arrival_time, EVENT_ARRIVAL, i);
+    }
+
+    // 남은 전환 비용은 스냅샷에 없으므로 비용이 있으면 끝까지 시뮬레이션
+    if (is_real_time(policy) && !detailed && (flags & SIM_STEADY_STATE) &&
+        e.core_count == 1 && e.switch_cost == 0)
+        run_steady_state(&e);
+    else
+        run_engine(&e);
+
+    // EDF/RMS의 인스턴스별 결과는 완료할 때 기록에 옮겨 두었다
+    if (!is_real_time(policy))
+        result->outcomes = state->outcome;
+
+    free_queues(&e);
+}
+
+// 워크로드 파일을 도착 순서대로 읽으면서 시뮬레이션
+// 메모리는 동시에 살아 있는 프로세스 수에 비례하고, 간트차트와
+// 프로세스별 결과는 남기지 않는다 (합계만 result에 기록)
+// EDF/RMS는 지원하지 않으며 성공 0, 실패 -1
+int simulate_stream(SchedulingPolicy policy, WorkloadReader *reader,
+                    int quantum, SimulationResult *result) {
+    Engine e;
+    init_engine(&e, policy, quantum, 0, result);
+
+    if (is_real_time(policy)) {
+        printf("Streaming simulation does not support EDF/RMS\n");
+        return -1;
+    }
+
+    SchedState state;
+    init_sched_state(&state, STREAM_INITIAL_SLOTS);
+    begin_run(&e, &state, STREAM_INITIAL_SLOTS);
+
+    Arena *scratch = &state.scratch;
+    e.source = reader;
+    e.capacity = STREAM_INITIAL_SLOTS;
+    e.slots = arena_alloc(scratch, sizeof(Process) * e.capacity);
+    e.processes = e.slots;
+    e.keys = arena_alloc(scratch, sizeof(long) * e.capacity);
+    e.free_slots = arena_alloc(scratch, sizeof(int) * e.capacity);
+    e.slot_io = arena_alloc(scratch, sizeof(IOArena) * e.capacity);
+    for (int i = 0; i < e.capacity; i++)
+        init_io_arena(&e.slot_io[i], 0);
+    e.last_arrival = INT_MIN;
+
+    init_cores(&e, NULL, e.capacity);
+    init_queues(&e, e.capacity);
+
+    feed_arrival(&e);
+    run_engine(&e);
+
+    free_queues(&e);
+    for (int i = 0; i < e.capacity; i++)
+        free_io_arena(&e.slot_io[i]);
+    free_sched_state(&state);
+
+    return e.source_error ? -1 : 0;
+}
+
+void free_simulation_result(SimulationResult *result) {
+    free_gantt_chart(&result->gantt);
+    if (result->core_gantt) {
+        for (int c = 0; c < result->core_count; c++)
+            free_gantt_chart(&result->core_gantt[c]);
+    }
+    arena_free(result->arena, result->instances);
+    arena_free(result->arena, result->misses);
+    arena_free(result->arena, result->aging_log);
+    memset(result, 0, sizeof(SimulationResult));
+}
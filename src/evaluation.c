@@ -1,8 +1,12 @@
 
 #include "evaluation.h"
+#include "analysis.h"
+#include "engine.h"
+#include "partition.h"
 #include "process.h"
 #include "queue.h"
 #include "scheduler.h"
+#include "workload.h"
 #include <dirent.h> // DIR, struct dirent, opendir, readdir, closedir
 #include <limits.h> // INT_MAX 등의 상수 정의
 #include <math.h>
@@ -12,6 +16,10 @@
 #include <string.h>
 #include <sys/stat.h> // 파일 및 디렉토리 상태 확인
 
+// Multi-I/O 상세 테이블의 I/O 열 수 범위
+#define IO_DETAIL_MIN_COLUMNS 3
+#define IO_DETAIL_MAX_COLUMNS 8
+
 void print_thin_emphasized_header(const char *title, int width) {
     int title_len = strlen(title);
     int left_padding = (width - title_len - 2) / 2;
@@ -64,322 +72,250 @@ void print_emphasized_header(const char *title, int width) {
     printf("╝\n");
 }
 
-// 간트차트 엔트리 추가 함수
-void add_gantt_entry(GanttChart *gantt, int start, int end, int pid,
-                     const char *status) {
-    if (gantt->count < gantt->capacity) {
-        gantt->entries[gantt->count].time_start = start;
-        gantt->entries[gantt->count].time_end = end;
-        gantt->entries[gantt->count].process_id = pid;
-        strcpy(gantt->entries[gantt->count].status, status);
-        gantt->count++;
-    }
+void init_gantt_chart(GanttChart *gantt, int capacity, Arena *arena) {
+    if (capacity < 1)
+        capacity = 1;
+    gantt->arena = arena;
+    gantt->entries = arena_alloc(arena, sizeof(GanttEntry) * capacity);
+    gantt->count = 0;
+    gantt->capacity = capacity;
 }
 
-void compare_algorithms(Process *processes, int count, Config *config,
-                        int max_time) {
-    print_emphasized_header("Algorithm Comparison", 150);
-
-    AlgorithmMetrics metrics[9];
-
-    Process *copy_processes = malloc(sizeof(Process) * count);
-    for (int i = 0; i < count; i++) {
-        copy_processes[i] = processes[i];
-    } // 이젠 딱히 필요없음 -> 이미 scheduling.c에서 해줌 (근데 혹시 모르니까)
-
-    // 1. FCFS
-    reset_processes(processes, count);
-    Metrics *metrics_temp = run_fcfs(processes, count);
-
-    int total_waiting = 0;
-    int total_turnaround = 0;
+void free_gantt_chart(GanttChart *gantt) {
+    arena_free(gantt->arena, gantt->entries);
+    gantt->entries = NULL;
+    gantt->count = 0;
+    gantt->capacity = 0;
+}
 
-    for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
+// 간트차트 엔트리 추가 함수
+// 직전 구간과 이어지는 같은 프로세스/상태면 구간만 늘림
+void add_gantt_entry(GanttChart *gantt, int start, int end, int pid,
+                     GanttStatus status) {
+    if (gantt->count > 0) {
+        GanttEntry *last = &gantt->entries[gantt->count - 1];
+        if (last->process_id == pid && last->status == status &&
+            last->time_end == start) {
+            last->time_end = end;
+            return;
+        }
     }
 
-    strcpy(metrics[0].name, "FCFS");
-    metrics[0].avg_wait_time = (float)total_waiting / count;
-    metrics[0].avg_turnaround_time = (float)total_turnaround / count;
-    metrics[0].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[0].throughput = ((float)count / metrics_temp->total_time) *
-                            100.0; // 단위 시간당 처리하는 프로세스 양
-    metrics[0].total_time = metrics_temp->total_time;
-    metrics[0].missed_deadlines = 0;
-
-    // 2. Non-preemptive SJF
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
+    if (gantt->count == gantt->capacity) {
+        int new_capacity = gantt->capacity > 0 ? gantt->capacity * 2 : 64;
+        gantt->entries = arena_realloc(gantt->arena, gantt->entries,
+                                       sizeof(GanttEntry) * gantt->capacity,
+                                       sizeof(GanttEntry) * new_capacity);
+        gantt->capacity = new_capacity;
     }
-    reset_processes(processes, count);
-    metrics_temp = run_sjf_np(processes, count);
-
-    total_waiting = 0;
-    total_turnaround = 0;
 
-    for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
-    }
+    gantt->entries[gantt->count].time_start = start;
+    gantt->entries[gantt->count].time_end = end;
+    gantt->entries[gantt->count].process_id = pid;
+    gantt->entries[gantt->count].status = status;
+    gantt->count++;
+}
 
-    strcpy(metrics[1].name, "Non-Preemptive SJF");
-    metrics[1].avg_wait_time = (float)total_waiting / count;
-    metrics[1].avg_turnaround_time = (float)total_turnaround / count;
-    metrics[1].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[1].throughput = ((float)count / metrics_temp->total_time) * 100.0;
-    metrics[1].total_time = metrics_temp->total_time;
-    metrics[1].missed_deadlines = 0;
-
-    // 3. Preemptive SJF
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
+// RMS 응답 시간 분석 판정 (스케줄 가능 1, 불가 0, 분석 불가 -1)
+static int rms_response_time_test(const Process *processes, int count) {
+    TaskResponse *responses =
+        malloc(sizeof(TaskResponse) * (count > 0 ? count : 1));
+    if (!responses) {
+        perror("schedulability analysis");
+        exit(1);
     }
-    reset_processes(processes, count);
-    metrics_temp = run_sjf_p(processes, count);
-
-    total_waiting = 0;
-    total_turnaround = 0;
+    int status = response_time_analysis(processes, count,
+                                        PRIORITY_RATE_MONOTONIC, responses);
+    free(responses);
+    return status;
+}
 
-    for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
-    }
+static const char *schedulability_name(int status) {
+    if (status < 0)
+        return "UNKNOWN";
+    return status ? "SCHEDULABLE" : "NOT SCHEDULABLE";
+}
 
-    strcpy(metrics[2].name, "Preemptive SJF");
-    metrics[2].avg_wait_time = (float)total_waiting / count;
-    metrics[2].avg_turnaround_time = (float)total_turnaround / count;
-    metrics[2].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[2].throughput = ((float)count / metrics_temp->total_time) * 100.0;
-    metrics[2].total_time = metrics_temp->total_time;
-    metrics[2].missed_deadlines = 0;
-
-    // 4. Non-preemptive Priority
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
+static const char *short_algorithm_name(const char *name) {
+    if (strcmp(name, "Non-Preemptive SJF") == 0) {
+        return "NP SJF";
+    } else if (strcmp(name, "Preemptive SJF") == 0) {
+        return "P SJF";
+    } else if (strcmp(name, "Non-Preemptive Priority") == 0) {
+        return "NP Priority";
+    } else if (strcmp(name, "Preemptive Priority") == 0) {
+        return "P Priority";
+    } else if (strcmp(name, "Priority with Aging") == 0) {
+        return "Priority+Aging";
     }
-    reset_processes(processes, count);
-    metrics_temp = run_priority_np(processes, count);
-
-    total_waiting = 0;
-    total_turnaround = 0;
+    return name;
+}
 
-    for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
+// 알고리즘별 비교 지표 출력 (EDF, RMS는 avg_turnaround_time이 음수)
+void write_algorithm_metrics(FILE *fp, AlgorithmMetrics *metrics, int count,
+                             OutputFormat format) {
+    if (format == OUTPUT_CSV) {
+        fprintf(fp, "algorithm,avg_wait_time,avg_turnaround_time,"
+                    "cpu_utilization,throughput,total_time,"
+                    "missed_deadlines,cores,p95_turnaround,steals,"
+                    "migrations,switches,overhead_time\n");
+        for (int i = 0; i < count; i++) {
+            AlgorithmMetrics *m = &metrics[i];
+            fprintf(fp, "%s,%.4f,", m->name, m->avg_wait_time);
+            if (m->avg_turnaround_time < 0) {
+                fprintf(fp, ",");
+            } else {
+                fprintf(fp, "%.4f,", m->avg_turnaround_time);
+            }
+            fprintf(fp, "%.4f,%.4f,%d,%d,%d,", m->cpu_utilization,
+                    m->throughput, m->total_time, m->missed_deadlines,
+                    m->cores);
+            if (m->p95_turnaround < 0) {
+                fprintf(fp, ",");
+            } else {
+                fprintf(fp, "%.4f,", m->p95_turnaround);
+            }
+            fprintf(fp, "%d,%d,%d,%d\n", m->steals, m->migrations,
+                    m->switches, m->overhead_time);
+        }
+        return;
     }
 
-    strcpy(metrics[3].name, "Non-Preemptive Priority");
-    metrics[3].avg_wait_time = (float)total_waiting / count;
-    metrics[3].avg_turnaround_time = (float)total_turnaround / count;
-    metrics[3].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[3].throughput = ((float)count / metrics_temp->total_time) * 100.0;
-    metrics[3].total_time = metrics_temp->total_time;
-    metrics[3].missed_deadlines = 0;
-
-    // 5. Preemptive Priority
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
+    if (format == OUTPUT_JSON) {
+        fprintf(fp, "[\n");
+        for (int i = 0; i < count; i++) {
+            AlgorithmMetrics *m = &metrics[i];
+            fprintf(fp, "  {\"algorithm\": \"%s\", \"avg_wait_time\": %.4f, ",
+                    m->name, m->avg_wait_time);
+            if (m->avg_turnaround_time < 0) {
+                fprintf(fp, "\"avg_turnaround_time\": null, ");
+            } else {
+                fprintf(fp, "\"avg_turnaround_time\": %.4f, ",
+                        m->avg_turnaround_time);
+            }
+            fprintf(fp,
+                    "\"cpu_utilization\": %.4f, \"throughput\": %.4f, "
+                    "\"total_time\": %d, \"missed_deadlines\": %d, "
+                    "\"cores\": %d, ",
+                    m->cpu_utilization, m->throughput, m->total_time,
+                    m->missed_deadlines, m->cores);
+            if (m->p95_turnaround < 0) {
+                fprintf(fp, "\"p95_turnaround\": null, ");
+            } else {
+                fprintf(fp, "\"p95_turnaround\": %.4f, ", m->p95_turnaround);
+            }
+            fprintf(fp,
+                    "\"steals\": %d, \"migrations\": %d, \"switches\": %d, "
+                    "\"overhead_time\": %d}%s\n",
+                    m->steals, m->migrations, m->switches, m->overhead_time,
+                    i + 1 < count ? "," : "");
+        }
+        fprintf(fp, "]\n");
+        return;
     }
-    reset_processes(processes, count);
-    metrics_temp = run_priority_p(processes, count);
 
-    total_waiting = 0;
-    total_turnaround = 0;
+    fprintf(fp,
+            "+----------------------+---------------+------------------+------"
+            "--------+------------+------------------+\n");
+    fprintf(fp, "| Algorithm            | Avg Wait Time | Avg Turnaround   | "
+                "CPU Util (%%) | Throughput | Missed Deadlines |\n");
+    fprintf(fp,
+            "+----------------------+---------------+------------------+------"
+            "--------+------------+------------------+\n");
 
     for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
-    }
+        AlgorithmMetrics *m = &metrics[i];
+        const char *short_name = short_algorithm_name(m->name);
 
-    strcpy(metrics[4].name, "Preemptive Priority");
-    metrics[4].avg_wait_time = (float)total_waiting / count;
-    metrics[4].avg_turnaround_time = (float)total_turnaround / count;
-    metrics[4].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[4].throughput = ((float)count / metrics_temp->total_time) * 100.0;
-    metrics[4].total_time = metrics_temp->total_time;
-    metrics[4].missed_deadlines = 0;
-
-    // 6. Round Robin
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
+        // EDF, RMS의 경우 turnaround time을 "-"로 표시
+        if (m->avg_turnaround_time < 0) {
+            fprintf(fp,
+                    "| %-20s | %13.2f | %16s | %11.2f%% | %10.4f | %16d |\n",
+                    short_name, m->avg_wait_time, "-", m->cpu_utilization,
+                    m->throughput, m->missed_deadlines);
+        } else { // 일반 알고리즘들
+            fprintf(fp,
+                    "| %-20s | %13.2f | %16.2f | %11.2f%% | %10.4f | %16s |\n",
+                    short_name, m->avg_wait_time, m->avg_turnaround_time,
+                    m->cpu_utilization, m->throughput, "N/A");
+        }
     }
-    reset_processes(processes, count);
-    metrics_temp = run_rr(processes, count, config);
-
-    total_waiting = 0;
-    total_turnaround = 0;
 
+    fprintf(fp,
+            "+----------------------+---------------+------------------+------"
+            "--------+------------+------------------+\n");
+
+    // 꼬리 지연, 문맥 전환 비용, 코어 간 이동은 따로 표시
+    fprintf(fp, "+----------------------+-------+----------------+----------+--"
+                "--------+--------+------------+\n");
+    fprintf(fp, "| Algorithm            | Cores | P95 Turnaround | Switches | "
+                "Overhead | Steals | Migrations |\n");
+    fprintf(fp, "+----------------------+-------+----------------+----------+--"
+                "--------+--------+------------+\n");
     for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
+        AlgorithmMetrics *m = &metrics[i];
+        const char *short_name = short_algorithm_name(m->name);
+        char p95[24] = "-";
+        if (m->p95_turnaround >= 0)
+            snprintf(p95, sizeof(p95), "%.2f", m->p95_turnaround);
+        fprintf(fp, "| %-20s | %5d | %14s | %8d | %8d | %6d | %10d |\n",
+                short_name, m->cores, p95, m->switches, m->overhead_time,
+                m->steals, m->migrations);
     }
+    fprintf(fp, "+----------------------+-------+----------------+----------+--"
+                "--------+--------+------------+\n");
+}
 
-    strcpy(metrics[5].name, "Round Robin");
-    metrics[5].avg_wait_time = (float)total_waiting / count;
-    metrics[5].avg_turnaround_time = (float)total_turnaround / count;
-    metrics[5].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[5].throughput = ((float)count / metrics_temp->total_time) * 100.0;
-    metrics[5].total_time = metrics_temp->total_time;
-    metrics[5].missed_deadlines = 0;
-
-    // 7. Priority with Aging
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
-    }
-    reset_processes(processes, count);
-    metrics_temp = run_priority_with_aging(processes, count);
+// 비교 대상 알고리즘 (실행/출력 순서, 표의 위치)
+typedef struct {
+    SchedulingPolicy policy;
+    int slot;
+} ComparisonEntry;
+
+static const ComparisonEntry comparison_entries[] = {
+    {POLICY_FCFS, 0},
+    {POLICY_SJF_NP, 1},
+    {POLICY_SJF_P, 2},
+    {POLICY_PRIORITY_NP, 3},
+    {POLICY_PRIORITY_P, 4},
+    {POLICY_RR, 5},
+    {POLICY_PRIORITY_AGING, 6},
+    {POLICY_RMS, 8},
+    {POLICY_EDF, 7},
+};
+
+#define COMPARISON_COUNT                                                       \
+    ((int)(sizeof(comparison_entries) / sizeof(comparison_entries[0])))
 
-    total_waiting = 0;
-    total_turnaround = 0;
+void compare_algorithms(Process *processes, int count, Config *config,
+                        int max_time) {
+    print_emphasized_header("Algorithm Comparison", 150);
 
-    for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
-    }
+    AlgorithmMetrics metrics[9];
 
-    strcpy(metrics[6].name, "Priority with Aging");
-    metrics[6].avg_wait_time = (float)total_waiting / count;
-    metrics[6].avg_turnaround_time = (float)total_turnaround / count;
-    metrics[6].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[6].throughput = ((float)count / metrics_temp->total_time) * 100.0;
-    metrics[6].total_time = metrics_temp->total_time;
-    metrics[6].missed_deadlines = 0;
-
-    // 9. RMS
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
-    }
-    reset_processes(processes, count);
-    metrics_temp = run_rms(processes, count, config, max_time);
-    int rms_counter = metrics_temp->for_edf_rms_counter;
-
-    total_waiting = 0;
-    int rms_completed_processes = 0;
-    int rms_missed_deadlines = config->deadline_miss_info_count;
-
-    for (int i = 0; i < rms_counter; i++) {
-        if (metrics_temp->for_edf_rms_processes[i].comp_time > 0) {
-            total_waiting +=
-                metrics_temp->for_edf_rms_processes[i].waiting_time;
-            rms_completed_processes++;
-        }
+    // 시뮬레이션은 서로 독립적이므로 병렬로 수행하고,
+    // 출력은 기존 순서대로 하나씩 한다
+    PolicyRun runs[COMPARISON_COUNT];
+    for (int i = 0; i < COMPARISON_COUNT; i++) {
+        runs[i].policy = comparison_entries[i].policy;
     }
+    simulate_policies(runs, COMPARISON_COUNT, processes, count, config,
+                      max_time);
 
-    strcpy(metrics[8].name, "RMS");
-    metrics[8].avg_wait_time =
-        rms_completed_processes > 0 ? (float)total_waiting / rms_counter : 0.0;
-    metrics[8].avg_turnaround_time =
-        -1.0; // RMS는 turnaround time을 계산하지 않음
-    metrics[8].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[8].throughput =
-        ((float)rms_completed_processes / metrics_temp->total_time) * 100.0;
-    metrics[8].total_time = metrics_temp->total_time;
-    metrics[8].missed_deadlines = rms_missed_deadlines;
-
-    // 8. EDF
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
-    }
-    reset_processes(processes, count);
-    metrics_temp = run_edf(processes, count, config, max_time);
-    int edf_counter = metrics_temp->for_edf_rms_counter;
-
-    total_waiting = 0;
-    int edf_completed_processes = 0;
-    int edf_missed_deadlines = config->deadline_miss_info_count;
-
-    for (int i = 0; i < edf_counter; i++) {
-        if (metrics_temp->for_edf_rms_processes[i].comp_time > 0) {
-            total_waiting +=
-                metrics_temp->for_edf_rms_processes[i].waiting_time;
-            edf_completed_processes++;
-        }
-    }
+    for (int i = 0; i < COMPARISON_COUNT; i++) {
+        collect_algorithm_metrics(&metrics[comparison_entries[i].slot],
+                                  runs[i].policy, &runs[i].result);
 
-    strcpy(metrics[7].name, "EDF");
-    metrics[7].avg_wait_time =
-        edf_completed_processes > 0 ? (float)total_waiting / edf_counter : 0.0;
-    metrics[7].avg_turnaround_time =
-        -1.0; // EDF는 turnaround time을 계산하지 않음
-    metrics[7].cpu_utilization =
-        ((float)(metrics_temp->total_time - metrics_temp->idle_time) /
-         metrics_temp->total_time) *
-        100.0;
-    metrics[7].throughput =
-        ((float)edf_completed_processes / metrics_temp->total_time) * 100.0;
-    metrics[7].total_time = metrics_temp->total_time;
-    metrics[7].missed_deadlines = edf_missed_deadlines;
+        Metrics *metrics_temp = report_simulation(
+            runs[i].policy, processes, count, config, &runs[i].result);
+        free(metrics_temp);
+        free_policy_run(&runs[i]);
+    }
 
     printf("\n\n");
     print_thin_emphasized_header("CPU Scheduling Algorithm Comparison", 115);
     printf("\n");
-    printf(
-        "+----------------------+---------------+------------------+----------"
-        "----+------------+------------------+\n");
-    printf("| Algorithm            | Avg Wait Time | Avg Turnaround   | CPU "
-           "Util (%%) | Throughput | Missed Deadlines |\n");
-    printf(
-        "+----------------------+---------------+------------------+----------"
-        "----+------------+------------------+\n");
-
-    for (int i = 0; i < 9; i++) {
-        char short_name[20];
-        if (strcmp(metrics[i].name, "Non-Preemptive SJF") == 0) {
-            strcpy(short_name, "NP SJF");
-        } else if (strcmp(metrics[i].name, "Preemptive SJF") == 0) {
-            strcpy(short_name, "P SJF");
-        } else if (strcmp(metrics[i].name, "Non-Preemptive Priority") == 0) {
-            strcpy(short_name, "NP Priority");
-        } else if (strcmp(metrics[i].name, "Preemptive Priority") == 0) {
-            strcpy(short_name, "P Priority");
-        } else if (strcmp(metrics[i].name, "Priority with Aging") == 0) {
-            strcpy(short_name, "Priority+Aging");
-        } else {
-            strcpy(short_name, metrics[i].name);
-        }
-
-        // EDF, RMS의 경우 turnaround time을 "-"로 표시
-        if (i == 7 || i == 8) { // EDF, RMS
-            printf("| %-20s | %13.2f | %16s | %11.2f%% | %10.4f | %16d |\n",
-                   short_name, metrics[i].avg_wait_time, "-",
-                   metrics[i].cpu_utilization, metrics[i].throughput,
-                   metrics[i].missed_deadlines);
-        } else { // 일반 알고리즘들
-            printf("| %-20s | %13.2f | %16.2f | %11.2f%% | %10.4f | %16s |\n",
-                   short_name, metrics[i].avg_wait_time,
-                   metrics[i].avg_turnaround_time, metrics[i].cpu_utilization,
-                   metrics[i].throughput, "N/A");
-        }
-    }
-
-    printf(
-        "+----------------------+---------------+------------------+----------"
-        "----+------------+------------------+\n");
+    write_algorithm_metrics(stdout, metrics, 9, OUTPUT_TEXT);
 
     // 사용자로부터 리포트 파일명 입력받기
     char report_filename[256];
@@ -426,14 +362,8 @@ void compare_algorithms(Process *processes, int count, Config *config,
         float total_theoretical_util = 0.0;
         for (int i = 0; i < count; i++) {
             // I/O 시간 계산
-            int total_io_time = 0;
-            int io_count = 0;
-            for (int j = 0; j < MAX_IO_OPERATIONS; j++) {
-                if (processes[i].io_operations[j].io_start != -1) {
-                    total_io_time += processes[i].io_operations[j].io_burst;
-                    io_count++;
-                }
-            }
+            int total_io_time = get_total_io_time(&processes[i]);
+            int io_count = processes[i].io_count;
 
             int execution_time = processes[i].cpu_burst + total_io_time;
             float individual_util = (float)execution_time / processes[i].period;
@@ -460,15 +390,15 @@ void compare_algorithms(Process *processes, int count, Config *config,
                 rms_bound * 100);
         fprintf(fp, "• EDF Theoretical Bound: 1.000 (100.00%%)\n\n");
 
+        // 이용률 상한 대신 정확한 검사로 판정
+        DemandResult edf;
+        int edf_status = processor_demand_test(processes, count, &edf);
+        int rms_status = rms_response_time_test(processes, count);
         fprintf(fp, "Schedulability Prediction:\n");
-        fprintf(fp, "• EDF: %s (Utilization %s 100%%)\n",
-                total_theoretical_util <= 1.0 ? "SCHEDULABLE"
-                                              : "NOT SCHEDULABLE",
-                total_theoretical_util <= 1.0 ? "<=" : ">");
-        fprintf(
-            fp, "• RMS: %s (Utilization %s %.2f%%)\n\n",
-            total_theoretical_util <= rms_bound ? "SCHEDULABLE" : "UNCERTAIN",
-            total_theoretical_util <= rms_bound ? "<=" : ">", rms_bound * 100);
+        fprintf(fp, "• EDF: %s (processor demand test)\n",
+                schedulability_name(edf_status));
+        fprintf(fp, "• RMS: %s (response-time analysis)\n\n",
+                schedulability_name(rms_status));
 
         // 성능 메트릭 상세 표
         fprintf(fp, "PERFORMANCE METRICS COMPARISON:\n");
@@ -646,12 +576,8 @@ void compare_algorithms(Process *processes, int count, Config *config,
         int total_io_ops = 0;
         int total_io_time = 0;
         for (int i = 0; i < count; i++) {
-            for (int j = 0; j < MAX_IO_OPERATIONS; j++) {
-                if (processes[i].io_operations[j].io_start != -1) {
-                    total_io_ops++;
-                    total_io_time += processes[i].io_operations[j].io_burst;
-                }
-            }
+            total_io_ops += processes[i].io_count;
+            total_io_time += get_total_io_time(&processes[i]);
         }
 
         fprintf(fp, "   • Total I/O operations: %d\n", total_io_ops);
@@ -676,11 +602,11 @@ void compare_algorithms(Process *processes, int count, Config *config,
         fprintf(fp, "\n");
 
         fprintf(fp, "   • For Real-Time Systems:\n");
-        if (total_theoretical_util <= rms_bound) {
+        if (rms_status == 1) {
             fprintf(fp, "     - Both EDF and RMS are suitable\n");
             fprintf(fp, "     - RMS preferred for predictable behavior\n");
             fprintf(fp, "     - EDF preferred for maximum utilization\n");
-        } else if (total_theoretical_util <= 1.0) {
+        } else if (edf_status == 1) {
             fprintf(fp, "     - EDF is strongly recommended\n");
             fprintf(fp, "     - RMS may experience deadline misses\n");
             fprintf(fp, "     - Consider reducing system load for RMS\n");
@@ -688,7 +614,22 @@ void compare_algorithms(Process *processes, int count, Config *config,
             fprintf(fp,
                     "     - System is overloaded for real-time guarantees\n");
             fprintf(fp, "     - Reduce task load or increase periods\n");
-            fprintf(fp, "     - Consider task partitioning\n");
+            int edf_cores = minimum_partition_cores(
+                processes, count, PARTITION_FIRST_FIT, CORE_TEST_EDF);
+            int rms_cores = minimum_partition_cores(
+                processes, count, PARTITION_FIRST_FIT, CORE_TEST_RMS);
+            if (edf_cores > 0) {
+                fprintf(fp,
+                        "     - Consider task partitioning: first-fit "
+                        "decreasing needs %d cores for EDF",
+                        edf_cores);
+                if (rms_cores > 0)
+                    fprintf(fp, ", %d for RMS", rms_cores);
+                fprintf(fp, "\n");
+            } else if (edf_status == 0) {
+                fprintf(fp, "     - Some task cannot meet its deadline even "
+                            "on its own core\n");
+            }
         }
         fprintf(fp, "\n");
 
@@ -729,40 +670,30 @@ void compare_algorithms(Process *processes, int count, Config *config,
         printf("Please check if the 'result_example' directory exists.\n");
     }
 
-    for (int i = 0; i < count; i++) {
-        processes[i] = copy_processes[i];
-    }
-
-    free(copy_processes);
-    free(metrics_temp);
 }
 
-void display_performance_summary(Process *processes, int count, int total_time,
-                                 int idle_time) {
+// cores: 코어 수 (idle_time은 모든 코어의 유휴 시간 합)
+void display_performance_summary(Process *processes, ProcessOutcome *outcomes,
+                                 int count, int total_time, int idle_time,
+                                 int cores, int switches, int overhead_time) {
     int total_waiting = 0;
     int total_turnaround = 0;
     int total_io_operations = 0;
     int total_io_time = 0;
 
     for (int i = 0; i < count; i++) {
-        total_waiting += processes[i].waiting_time;
-        total_turnaround += processes[i].turnaround_time;
+        total_waiting += outcomes[i].waiting_time;
+        total_turnaround += outcomes[i].turnaround_time;
 
         // 멀티 I/O 통계 계산
-        int process_io_count = get_io_count(&processes[i]);
-        total_io_operations += process_io_count;
-
-        for (int j = 0; j < MAX_IO_OPERATIONS; j++) {
-            if (processes[i].io_operations[j].io_start != -1) {
-                total_io_time += processes[i].io_operations[j].io_burst;
-            }
-        }
+        total_io_operations += processes[i].io_count;
+        total_io_time += get_total_io_time(&processes[i]);
     }
 
     float avg_waiting = (float)total_waiting / count;
     float avg_turnaround = (float)total_turnaround / count;
-    float cpu_utilization =
-        ((float)(total_time - idle_time) / total_time) * 100.0;
+    float capacity = (float)total_time * cores;
+    float cpu_utilization = ((capacity - idle_time) / capacity) * 100.0;
     float avg_io_per_process = (float)total_io_operations / count;
     float io_intensity =
         (total_time > 0) ? ((float)total_io_time / total_time) * 100.0 : 0.0;
@@ -794,12 +725,19 @@ void display_performance_summary(Process *processes, int count, int total_time,
            io_intensity);
     printf("│ System Idle Time           : %6d time units (%5.2f %%)         "
            "│\n",
-           idle_time, ((float)idle_time / total_time) * 100.0);
+           idle_time, (idle_time / capacity) * 100.0);
+    printf(
+        "│ Context Switches           : %6d switches                     │\n",
+        switches);
+    printf("│ Switch Overhead            : %6d time units (%5.2f %%)         "
+           "│\n",
+           overhead_time, (overhead_time / capacity) * 100.0);
 
     print_section_end(66);
 }
 
-void display_process_table(Process *processes, int count) {
+void display_process_table(Process *processes, ProcessOutcome *outcomes,
+                           int count) {
     printf("\n");
     printf("** Process Table with Multi-I/O Information **\n");
 
@@ -814,7 +752,7 @@ void display_process_table(Process *processes, int count) {
 
     for (int i = 0; i < count; i++) {
         char missed_dl_str[10] = "No";
-        if (processes[i].missed_deadline) {
+        if (outcomes[i].missed_deadline) {
             strcpy(missed_dl_str, "Yes");
         }
 
@@ -822,8 +760,8 @@ void display_process_table(Process *processes, int count) {
                "%-6d |       %-8d |   %-6d |   %-6d | %-10s |\n",
                processes[i].pid, processes[i].cpu_burst,
                processes[i].arrival_time, processes[i].priority,
-               processes[i].comp_time, processes[i].waiting_time,
-               processes[i].turnaround_time, processes[i].deadline,
+               outcomes[i].comp_time, outcomes[i].waiting_time,
+               outcomes[i].turnaround_time, processes[i].deadline,
                processes[i].period, missed_dl_str);
     }
     printf("+-----+------------+-------------+----------+--------------+-------"
@@ -832,48 +770,57 @@ void display_process_table(Process *processes, int count) {
     // 멀티 I/O 상세 정보 테이블 - 수정된 버전
     printf("\n** Multi-I/O Operations Detail **\n");
 
+    // I/O 개수가 가장 많은 프로세스에 맞춰 열 수를 정함
+    // (너무 많으면 앞쪽 일부만 보여 주고 합계는 전체 I/O 기준)
+    int columns = IO_DETAIL_MIN_COLUMNS;
+    for (int i = 0; i < count; i++) {
+        if (processes[i].io_count > columns)
+            columns = processes[i].io_count;
+    }
+    if (columns > IO_DETAIL_MAX_COLUMNS)
+        columns = IO_DETAIL_MAX_COLUMNS;
+
     // 헤더 라인 1
     printf("+-----+----------+");
-    for (int i = 1; i <= MAX_IO_OPERATIONS; i++) {
+    for (int i = 1; i <= columns; i++) {
         printf("-------------+");
     }
     printf("--------------+\n");
 
     // 헤더 라인 2 - 컬럼 제목
     printf("| PID | I/O Count|");
-    for (int i = 1; i <= MAX_IO_OPERATIONS; i++) {
+    for (int i = 1; i <= columns; i++) {
         printf("   I/O %-2d    |", i);
     }
     printf("  I/O Total   |\n");
 
     // 헤더 라인 3 - 서브 헤더
     printf("|     |          |");
-    for (int i = 1; i <= MAX_IO_OPERATIONS; i++) {
+    for (int i = 1; i <= columns; i++) {
         printf(" Start:Burst |");
     }
     printf("              |\n");
 
     // 구분선
     printf("+-----+----------+");
-    for (int i = 1; i <= MAX_IO_OPERATIONS; i++) {
+    for (int i = 1; i <= columns; i++) {
         printf("-------------+");
     }
     printf("--------------+\n");
 
     // 데이터 행들
     for (int i = 0; i < count; i++) {
-        int io_count = get_io_count(&processes[i]);
-        int total_io_time = 0;
+        int io_count = processes[i].io_count;
+        int total_io_time = get_total_io_time(&processes[i]);
 
         printf("| P%-2d |    %-5d |", processes[i].pid, io_count);
 
         // 각 I/O 작업 정보 출력
-        for (int j = 0; j < MAX_IO_OPERATIONS; j++) {
-            if (processes[i].io_operations[j].io_start != -1) {
+        for (int j = 0; j < columns; j++) {
+            if (j < io_count) {
                 printf("   %2d:%-4d   |",
                        processes[i].io_operations[j].io_start,
                        processes[i].io_operations[j].io_burst);
-                total_io_time += processes[i].io_operations[j].io_burst;
             } else {
                 printf("     --      |");
             }
@@ -884,7 +831,7 @@ void display_process_table(Process *processes, int count) {
 
     // 마지막 구분선
     printf("+-----+----------+");
-    for (int i = 1; i <= MAX_IO_OPERATIONS; i++) {
+    for (int i = 1; i <= columns; i++) {
         printf("-------------+");
     }
     printf("--------------+\n");
@@ -901,20 +848,18 @@ void display_io_statistics(Process *processes, int count) {
     int total_io_time = 0;
 
     for (int i = 0; i < count; i++) {
-        int process_io_count = get_io_count(&processes[i]);
+        int process_io_count = processes[i].io_count;
         if (process_io_count > 0) {
             processes_with_io++;
             total_io_operations += process_io_count;
 
-            for (int j = 0; j < MAX_IO_OPERATIONS; j++) {
-                if (processes[i].io_operations[j].io_start != -1) {
-                    int burst = processes[i].io_operations[j].io_burst;
-                    total_io_time += burst;
-                    if (burst < min_io_burst)
-                        min_io_burst = burst;
-                    if (burst > max_io_burst)
-                        max_io_burst = burst;
-                }
+            for (int j = 0; j < process_io_count; j++) {
+                int burst = processes[i].io_operations[j].io_burst;
+                total_io_time += burst;
+                if (burst < min_io_burst)
+                    min_io_burst = burst;
+                if (burst > max_io_burst)
+                    max_io_burst = burst;
             }
         }
     }
@@ -947,43 +892,28 @@ void display_io_statistics(Process *processes, int count) {
     printf("└─────────────────────────────────────────────────────────────┘\n");
 }
 
-GanttChart *consolidate_gantt_chart(GanttChart *original) {
-    if (original->count == 0)
-        return original;
-
-    GanttChart *consolidated = malloc(sizeof(GanttChart));
-    consolidated->entries = malloc(sizeof(GanttEntry) * original->count);
-    consolidated->count = 0;
-    consolidated->capacity = original->count;
-
-    consolidated->entries[0] = original->entries[0];
-    consolidated->count = 1;
-
-    for (int i = 1; i < original->count; i++) {
-        int last_idx = consolidated->count - 1; // 마지막 인덱스 말하는거
-
-        if (consolidated->entries[last_idx].process_id ==
-            original->entries[i].process_id) {
-            consolidated->entries[last_idx].time_end =
-                original->entries[i].time_end;
-        } else {
-            consolidated->entries[consolidated->count] = original->entries[i];
-            consolidated->count++;
-        }
+// 실행이 아닌 구간의 표시 (유휴, 이전 비용, 문맥 전환 비용)
+static const char *overhead_label(GanttStatus status) {
+    switch (status) {
+    case GANTT_IDLE:
+        return "ID";
+    case GANTT_MIGRATION:
+        return "MG";
+    case GANTT_SWITCH:
+        return "CS";
+    case GANTT_RUN:
+        break;
     }
-
-    return consolidated;
+    return "";
 }
 
-void display_gantt_chart(GanttChart *gantt, const char *algorithm_name) {
-    printf("\n** Gantt Chart for %s **\n\n", algorithm_name);
-    GanttChart *consolidated = consolidate_gantt_chart(gantt);
+static void print_gantt_lane(GanttChart *gantt) {
     int i, j;
 
     printf(" ");
-    for (i = 0; i < consolidated->count; i++) {
-        int duration = consolidated->entries[i].time_end -
-                       consolidated->entries[i].time_start;
+    for (i = 0; i < gantt->count; i++) {
+        int duration = gantt->entries[i].time_end -
+                       gantt->entries[i].time_start;
         for (j = 0; j < duration; j++) {
             printf("--");
         }
@@ -991,16 +921,16 @@ void display_gantt_chart(GanttChart *gantt, const char *algorithm_name) {
     }
     printf("\n|");
 
-    for (i = 0; i < consolidated->count; i++) {
-        int duration = consolidated->entries[i].time_end -
-                       consolidated->entries[i].time_start;
+    for (i = 0; i < gantt->count; i++) {
+        int duration = gantt->entries[i].time_end -
+                       gantt->entries[i].time_start;
 
-        if (consolidated->entries[i].process_id == -1) {
+        if (gantt->entries[i].status != GANTT_RUN) {
             for (j = 0; j < duration - 1; j++) {
                 printf(" "); // duration -1 인 이유는 이게 절반 이기 때문임 ->
                              // -- 이게 두문자니까
             }
-            printf("ID");
+            printf("%s", overhead_label(gantt->entries[i].status));
             for (j = 0; j < duration - 1; j++) {
                 printf(" ");
             }
@@ -1008,7 +938,7 @@ void display_gantt_chart(GanttChart *gantt, const char *algorithm_name) {
             char pid_str[10];
             sprintf(
                 pid_str, "P%d",
-                consolidated->entries[i]
+                gantt->entries[i]
                     .process_id); // 문자열 길이 계산 가능해짐 -> 숫자를 문자로
 
             for (j = 0; j < duration - 1; j++) {
@@ -1023,9 +953,9 @@ void display_gantt_chart(GanttChart *gantt, const char *algorithm_name) {
     }
     printf("\n ");
 
-    for (i = 0; i < consolidated->count; i++) {
-        int duration = consolidated->entries[i].time_end -
-                       consolidated->entries[i].time_start;
+    for (i = 0; i < gantt->count; i++) {
+        int duration = gantt->entries[i].time_end -
+                       gantt->entries[i].time_start;
         for (j = 0; j < duration; j++) {
             printf("--");
         }
@@ -1034,10 +964,10 @@ void display_gantt_chart(GanttChart *gantt, const char *algorithm_name) {
     printf("\n");
 
     printf("0");
-    for (i = 0; i < consolidated->count; i++) {
-        int duration = consolidated->entries[i].time_end -
-                       consolidated->entries[i].time_start;
-        int end_time = consolidated->entries[i].time_end;
+    for (i = 0; i < gantt->count; i++) {
+        int duration = gantt->entries[i].time_end -
+                       gantt->entries[i].time_start;
+        int end_time = gantt->entries[i].time_end;
 
         for (j = 0; j < duration; j++) {
             printf("  ");
@@ -1054,9 +984,37 @@ void display_gantt_chart(GanttChart *gantt, const char *algorithm_name) {
         printf("%d", end_time);
     }
     printf("\n");
+}
 
-    free(consolidated->entries);
-    free(consolidated);
+void display_gantt_chart(GanttChart *gantt, const char *algorithm_name) {
+    printf("\n** Gantt Chart for %s **\n\n", algorithm_name);
+    print_gantt_lane(gantt);
+}
+
+// 멀티코어: 코어마다 한 줄씩 간트차트 출력
+void display_core_gantt_charts(GanttChart *lanes, int cores,
+                               const char *algorithm_name) {
+    printf("\n** Gantt Chart for %s (%d Cores) **\n", algorithm_name, cores);
+    for (int c = 0; c < cores; c++) {
+        printf("\nCore %d\n", c);
+        print_gantt_lane(&lanes[c]);
+    }
+}
+
+// 멀티코어: 코어별 실행 시간과 이용률
+void display_core_utilization(const int *core_busy, int cores,
+                              int total_time) {
+    printf("\n** Per-Core Utilization **\n");
+    printf("+------+------------+------------+---------------+\n");
+    printf("| Core | Busy Time  | Idle Time  | Utilization %% |\n");
+    printf("+------+------------+------------+---------------+\n");
+    for (int c = 0; c < cores; c++) {
+        float utilization =
+            total_time > 0 ? (float)core_busy[c] / total_time * 100.0 : 0.0;
+        printf("| %-4d | %-10d | %-10d | %-13.2f |\n", c, core_busy[c],
+               total_time - core_busy[c], utilization);
+    }
+    printf("+------+------------+------------+---------------+\n");
 }
 
 void save_processes_to_file(Process *processes, int count) {
@@ -1089,22 +1047,7 @@ void save_processes_to_file(Process *processes, int count) {
 
         // 각 프로세스 정보 저장
         for (int i = 0; i < count; i++) {
-            // 기본 프로세스 정보: PID 도착시간 CPU버스트 우선순위 데드라인 주기
-            // IO 개수
-            int io_count = get_io_count(&processes[i]);
-            fprintf(file, "%d %d %d %d %d %d %d\n", processes[i].pid,
-                    processes[i].arrival_time, processes[i].cpu_burst,
-                    processes[i].priority, processes[i].deadline,
-                    processes[i].period, io_count);
-
-            // 각 I/O 작업 정보 저장
-            for (int j = 0; j < MAX_IO_OPERATIONS; j++) {
-                if (processes[i].io_operations[j].io_start != -1) {
-                    fprintf(file, "%d %d\n",
-                            processes[i].io_operations[j].io_start,
-                            processes[i].io_operations[j].io_burst);
-                }
-            }
+            write_process_text(file, &processes[i]);
         }
 
         fclose(file);
@@ -1129,13 +1072,7 @@ void print_utilization_analysis(Process *original_processes, int count,
 
     for (int i = 0; i < count; i++) {
         // I/O 시간 계산
-        int total_io_time = 0;
-        for (int j = 0; j < MAX_IO_OPERATIONS; j++) {
-            if (original_processes[i].io_operations[j].io_start != -1) {
-                total_io_time +=
-                    original_processes[i].io_operations[j].io_burst;
-            }
-        }
+        int total_io_time = get_total_io_time(&original_processes[i]);
 
         int execution_time = original_processes[i].cpu_burst + total_io_time;
         float individual_util =
@@ -1165,24 +1102,37 @@ void print_utilization_analysis(Process *original_processes, int count,
 
     printf("+------+-------------+----------+-------------+---------------+\n");
 
-    // 스케줄링 가능성 예측
+    // 스케줄링 가능성 판정
+    // 이용률 상한은 충분조건일 뿐이므로 RMS는 응답 시간 분석,
+    // EDF는 프로세서 요구량 검사로 정확히 판정한다
+    if (strcmp(algorithm_name, "RMS") == 0)
+        print_response_times(original_processes, count,
+                             PRIORITY_RATE_MONOTONIC);
+
+    DemandResult edf;
+    int edf_status = processor_demand_test(original_processes, count, &edf);
+    int rms_status = rms_response_time_test(original_processes, count);
+
     printf("\n** Schedulability Prediction **\n");
-    printf("- EDF: %s (Utilization <= 100%%)\n",
-           total_utilization <= 1.0 ? "SCHEDULABLE" : "NOT SCHEDULABLE");
-    printf("- RMS: %s (Utilization <= %.2f%%)\n",
-           total_utilization <= rms_bound ? "SCHEDULABLE" : "UNCERTAIN",
-           rms_bound * 100);
+    printf("- EDF: %s (processor demand test", schedulability_name(edf_status));
+    if (edf.failure >= 0)
+        printf(", demand exceeds time at t = %lld", edf.failure);
+    printf(")\n");
+    printf("- RMS: %s (response-time analysis)\n",
+           schedulability_name(rms_status));
     printf("\n");
 }
 
-void display_scheduling_results(Process *processes, int count,
-                                GanttChart *gantt, int total_time,
-                                int idle_time, const char *algorithm_name) {
+void display_scheduling_results(Process *processes, ProcessOutcome *outcomes,
+                                int count, GanttChart *gantt, int total_time,
+                                int idle_time, int switches, int overhead_time,
+                                const char *algorithm_name) {
     display_gantt_chart(gantt, algorithm_name);
 
-    display_process_table(processes, count);
+    display_process_table(processes, outcomes, count);
 
-    display_performance_summary(processes, count, total_time, idle_time);
+    display_performance_summary(processes, outcomes, count, total_time,
+                                idle_time, 1, switches, overhead_time);
 
     display_io_statistics(processes, count);
 }
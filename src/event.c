@@ -0,0 +1,180 @@
+#include "event.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define WHEEL_MASK (EVENT_WHEEL_SIZE - 1)
+
+// a가 b보다 먼저 처리되어야 하면 1
+static int event_before(Event *a, Event *b) {
+    if (a->time != b->time)
+        return a->time < b->time;
+    if (a->order != b->order)
+        return a->order < b->order;
+    return a->key < b->key;
+}
+
+static void swap_events(Event *a, Event *b) {
+    Event temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+void init_event_queue(EventQueue *q, int capacity, Arena *arena) {
+    if (capacity < 1)
+        capacity = 1;
+    q->arena = arena;
+    q->data = (Event *)arena_alloc(arena, sizeof(Event) * capacity);
+    q->count = 0;
+    q->capacity = capacity;
+    memset(q->wheel, 0, sizeof(q->wheel));
+    q->occupied = 0;
+    q->base = 0;
+    q->wheel_count = 0;
+}
+
+void free_event_queue(EventQueue *q) {
+    arena_free(q->arena, q->data);
+    q->data = NULL;
+    q->count = 0;
+    q->capacity = 0;
+    for (int i = 0; i < EVENT_WHEEL_SIZE; i++) {
+        arena_free(q->arena, q->wheel[i].items);
+        q->wheel[i].items = NULL;
+    }
+    q->occupied = 0;
+    q->wheel_count = 0;
+}
+
+int is_event_queue_empty(EventQueue *q) {
+    return (q->count == 0 && q->wheel_count == 0);
+}
+
+// 같은 시각 칸에 (order, key) 순서를 유지하며 삽입
+// 대부분 뒤에 붙으므로 뒤에서부터 자리를 찾는다
+static void push_bucket(EventQueue *q, Event event) {
+    int slot = event.time & WHEEL_MASK;
+    EventBucket *b = &q->wheel[slot];
+
+    if (b->head + b->count == b->capacity) {
+        if (b->head > 0) {
+            memmove(b->items, b->items + b->head, sizeof(Event) * b->count);
+            b->head = 0;
+        } else {
+            int capacity = b->capacity ? b->capacity * 2 : 4;
+            b->items = (Event *)arena_realloc(q->arena, b->items,
+                                              sizeof(Event) * b->capacity,
+                                              sizeof(Event) * capacity);
+            b->capacity = capacity;
+        }
+    }
+
+    int i = b->head + b->count;
+    while (i > b->head && event_before(&event, &b->items[i - 1])) {
+        b->items[i] = b->items[i - 1];
+        i--;
+    }
+    b->items[i] = event;
+    b->count++;
+
+    q->occupied |= 1ULL << slot;
+    q->wheel_count++;
+}
+
+// base 이후 가장 이른 칸 (휠이 비어 있지 않을 때만 호출)
+static int first_slot(EventQueue *q) {
+    int start = q->base & WHEEL_MASK;
+    unsigned long long rotated = q->occupied >> start;
+    if (start > 0)
+        rotated |= q->occupied << (EVENT_WHEEL_SIZE - start);
+    return (start + __builtin_ctzll(rotated)) & WHEEL_MASK;
+}
+
+// 휠과 힙 중 맨 앞 이벤트가 있는 쪽 (휠이면 칸 번호, 힙이면 -1)
+static int front_slot(EventQueue *q) {
+    if (q->wheel_count == 0)
+        return -1;
+    int slot = first_slot(q);
+    EventBucket *b = &q->wheel[slot];
+    if (q->count > 0 && event_before(&q->data[0], &b->items[b->head]))
+        return -1;
+    return slot;
+}
+
+void push_event(EventQueue *q, Event event) {
+    // 휠이 비어 있으면 새 이벤트 시각부터 휠 구간을 다시 잡는다
+    if (q->wheel_count == 0)
+        q->base = event.time;
+    if (event.time >= q->base && event.time - q->base < EVENT_WHEEL_SIZE) {
+        push_bucket(q, event);
+        return;
+    }
+
+    if (q->count == q->capacity) {
+        q->data = (Event *)arena_realloc(q->arena, q->data,
+                                         sizeof(Event) * q->capacity,
+                                         sizeof(Event) * q->capacity * 2);
+        q->capacity *= 2;
+    }
+
+    // 마지막에 넣고 위로 올림
+    int i = q->count++;
+    q->data[i] = event;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!event_before(&q->data[i], &q->data[parent]))
+            break;
+        swap_events(&q->data[i], &q->data[parent]);
+        i = parent;
+    }
+}
+
+static Event pop_heap(EventQueue *q) {
+    Event top = q->data[0];
+    q->data[0] = q->data[--q->count];
+
+    // 루트에서 아래로 내림
+    int i = 0;
+    while (1) {
+        int left = i * 2 + 1;
+        int right = left + 1;
+        int smallest = i;
+        if (left < q->count && event_before(&q->data[left], &q->data[smallest]))
+            smallest = left;
+        if (right < q->count &&
+            event_before(&q->data[right], &q->data[smallest]))
+            smallest = right;
+        if (smallest == i)
+            break;
+        swap_events(&q->data[i], &q->data[smallest]);
+        i = smallest;
+    }
+    return top;
+}
+
+Event pop_event(EventQueue *q) {
+    Event top;
+    int slot = front_slot(q);
+    if (slot >= 0) {
+        EventBucket *b = &q->wheel[slot];
+        top = b->items[b->head++];
+        if (--b->count == 0) {
+            b->head = 0;
+            q->occupied &= ~(1ULL << slot);
+        }
+        q->wheel_count--;
+    } else {
+        top = pop_heap(q);
+    }
+
+    // 꺼낸 이벤트는 남은 모든 이벤트보다 이르므로 휠 구간을 앞으로 당길 수 있다
+    if (top.time > q->base)
+        q->base = top.time;
+    return top;
+}
+
+Event peek_event(EventQueue *q) {
+    int slot = front_slot(q);
+    if (slot >= 0)
+        return q->wheel[slot].items[q->wheel[slot].head];
+    return q->data[0];
+}
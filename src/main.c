@@ -1,3 +1,4 @@
+#include "cli.h"
 #include "config.h"
 #include "evaluation.h"
 #include "process.h"
@@ -7,7 +8,16 @@
 #include <stdlib.h>
 #include <time.h>
 
-int main() {
+int main(int argc, char *argv[]) {
+    // 인자가 있으면 프롬프트 없이 배치 모드로 실행
+    if (argc > 1) {
+        CliOptions options;
+        int status = parse_cli_options(argc, argv, &options);
+        if (status != 0)
+            return status < 0 ? 1 : 0;
+        return run_batch(&options);
+    }
+
     srand(time(NULL));
 
     int max_time; // for EDF, RMS
@@ -27,6 +37,10 @@ int main() {
     }
 
     Process *processes = create_processes(process_count, mode);
+    if (processes == NULL) {
+        free(process_count);
+        return 1;
+    }
 
     Config system_config;
     init_config(&system_config, mode);
@@ -48,37 +62,38 @@ int main() {
         printf("Enter your choice: ");
         scanf("%d", &choice);
 
+        Metrics *metrics = NULL;
         switch (choice) {
         case 1:
-            run_fcfs(processes, count);
+            metrics = run_fcfs(processes, count);
             break;
         case 2:
-            run_sjf_np(processes, count);
+            metrics = run_sjf_np(processes, count);
             break;
         case 3:
-            run_sjf_p(processes, count);
+            metrics = run_sjf_p(processes, count);
             break;
         case 4:
-            run_priority_np(processes, count);
+            metrics = run_priority_np(processes, count);
             break;
         case 5:
-            run_priority_p(processes, count);
+            metrics = run_priority_p(processes, count);
             break;
         case 6:
-            run_rr(processes, count, &system_config);
+            metrics = run_rr(processes, count, &system_config);
             break;
         case 7:
-            run_priority_with_aging(processes, count);
+            metrics = run_priority_with_aging(processes, count);
             break;
         case 8:
             printf("Enter max time(for RMS): ");
             scanf("%d", &max_time);
-            run_rms(processes, count, &system_config, max_time);
+            metrics = run_rms(processes, count, &system_config, max_time);
             break;
         case 9:
             printf("Enter max time(for EDF): ");
             scanf("%d", &max_time);
-            run_edf(processes, count, &system_config, max_time);
+            metrics = run_edf(processes, count, &system_config, max_time);
             break;
         case 10:
             printf("Enter max time(for EDF, RMS): ");
@@ -89,10 +104,12 @@ int main() {
             if (mode != 'f')
                 save_processes_to_file(processes, count);
             free(processes);
+            free(process_count);
             return 0;
         default:
             printf("Invalid choice. Try again.\n");
         }
+        free(metrics);
     }
 
     return 0;
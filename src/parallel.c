@@ -0,0 +1,71 @@
+#include "parallel.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+    ParallelTask task;
+    void *arg;
+    int task_count;
+    int next_index; // 다음에 가져갈 작업 번호
+    pthread_mutex_t lock;
+} TaskPool;
+
+static void *worker_main(void *data) {
+    TaskPool *pool = (TaskPool *)data;
+
+    while (1) {
+        pthread_mutex_lock(&pool->lock);
+        int index = pool->next_index++;
+        pthread_mutex_unlock(&pool->lock);
+
+        if (index >= pool->task_count)
+            break;
+        pool->task(pool->arg, index);
+    }
+    return NULL;
+}
+
+// 사용 가능한 CPU 코어 수
+int default_thread_count(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (int)cores : 1;
+}
+
+// task(arg, 0) ~ task(arg, task_count - 1)을 스레드 풀에서 나눠 실행
+// thread_count가 0 이하이면 CPU 코어 수만큼 스레드를 사용한다
+void parallel_for(int task_count, int thread_count, ParallelTask task,
+                  void *arg) {
+    if (thread_count <= 0)
+        thread_count = default_thread_count();
+    if (thread_count > task_count)
+        thread_count = task_count;
+
+    TaskPool pool;
+    pool.task = task;
+    pool.arg = arg;
+    pool.task_count = task_count;
+    pool.next_index = 0;
+    pthread_mutex_init(&pool.lock, NULL);
+
+    // 스레드 하나면 현재 스레드에서 바로 실행
+    pthread_t *threads = NULL;
+    int started = 0;
+    if (thread_count > 1) {
+        threads = malloc(sizeof(pthread_t) * (thread_count - 1));
+        for (int i = 0; threads && i < thread_count - 1; i++) {
+            if (pthread_create(&threads[i], NULL, worker_main, &pool) != 0)
+                break;
+            started++;
+        }
+    }
+
+    worker_main(&pool);
+
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    free(threads);
+    pthread_mutex_destroy(&pool.lock);
+}
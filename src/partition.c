@@ -0,0 +1,383 @@
+#include "partition.h"
+#include "analysis.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// 이용률 비교의 부동소수점 오차 허용치
+#define UTILIZATION_EPSILON 1e-9
+
+static const PartitionFit bin_packing_fits[] = {
+    PARTITION_FIRST_FIT,
+    PARTITION_BEST_FIT,
+    PARTITION_WORST_FIT,
+};
+
+#define BIN_PACKING_FIT_COUNT                                                  \
+    ((int)(sizeof(bin_packing_fits) / sizeof(bin_packing_fits[0])))
+
+typedef struct {
+    int index;
+    double utilization;
+} TaskLoad;
+
+// 코어별 배정 상태 (코어마다 배정 순서대로 태스크를 연결)
+typedef struct {
+    int cores;
+    int *first;        // 코어의 첫 태스크 (-1: 없음)
+    int *last;         // 코어의 마지막 태스크
+    int *next;         // 태스크별로 같은 코어의 다음 태스크
+    int *member_count; // 코어별 태스크 수
+    double *load;      // 코어별 이용률 합
+    int *implicit;     // 코어의 모든 태스크가 데드라인 >= 주기인지
+    Process *buffer;   // 검사할 태스크 집합을 모으는 자리
+} CoreSet;
+
+static void *check_alloc(void *ptr) {
+    if (!ptr) {
+        perror("task partitioning");
+        exit(1);
+    }
+    return ptr;
+}
+
+static double task_utilization(const Process *p) {
+    return (double)(p->cpu_burst + get_total_io_time(p)) / p->period;
+}
+
+static int implicit_deadline(const Process *p) {
+    return p->deadline - p->arrival_time >= p->period;
+}
+
+// 이용률이 큰 태스크부터, 같으면 태스크 번호 순서로
+static int compare_load(const void *a, const void *b) {
+    const TaskLoad *x = (const TaskLoad *)a;
+    const TaskLoad *y = (const TaskLoad *)b;
+    if (x->utilization != y->utilization)
+        return x->utilization > y->utilization ? -1 : 1;
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+static void init_core_set(CoreSet *set, int count, int cores) {
+    int slots = count > 0 ? count : 1;
+    set->cores = cores;
+    set->first = check_alloc(malloc(sizeof(int) * cores));
+    set->last = check_alloc(malloc(sizeof(int) * cores));
+    set->next = check_alloc(malloc(sizeof(int) * slots));
+    set->member_count = check_alloc(calloc(cores, sizeof(int)));
+    set->load = check_alloc(calloc(cores, sizeof(double)));
+    set->implicit = check_alloc(malloc(sizeof(int) * cores));
+    set->buffer = check_alloc(malloc(sizeof(Process) * slots));
+    for (int c = 0; c < cores; c++) {
+        set->first[c] = -1;
+        set->implicit[c] = 1;
+    }
+}
+
+static void free_core_set(CoreSet *set) {
+    free(set->first);
+    free(set->last);
+    free(set->next);
+    free(set->member_count);
+    free(set->load);
+    free(set->implicit);
+    free(set->buffer);
+}
+
+static void assign_task(CoreSet *set, const Process *tasks, int core,
+                        int task) {
+    set->next[task] = -1;
+    if (set->first[core] == -1)
+        set->first[core] = task;
+    else
+        set->next[set->last[core]] = task;
+    set->last[core] = task;
+    set->member_count[core]++;
+    set->load[core] += task_utilization(&tasks[task]);
+    if (!implicit_deadline(&tasks[task]))
+        set->implicit[core] = 0;
+}
+
+// core의 태스크에 extra(-1이면 없음)를 더한 집합이 test를 통과하는지
+static int core_accepts(CoreSet *set, const Process *tasks, int core,
+                        int extra, CoreTest test) {
+    int n = set->member_count[core];
+    double load = set->load[core];
+    int implicit = set->implicit[core];
+    if (extra >= 0) {
+        n++;
+        load += task_utilization(&tasks[extra]);
+        implicit = implicit && implicit_deadline(&tasks[extra]);
+    }
+    if (n == 0)
+        return 1;
+    if (load > 1.0 + UTILIZATION_EPSILON)
+        return 0;
+
+    // 이용률 상한은 충분조건이므로 통과하면 바로 받아 준다
+    if (implicit) {
+        if (test == CORE_TEST_EDF)
+            return 1;
+        if (load <= n * (pow(2.0, 1.0 / n) - 1) + UTILIZATION_EPSILON)
+            return 1;
+    }
+
+    int k = 0;
+    for (int task = set->first[core]; task != -1; task = set->next[task]) {
+        set->buffer[k++] = tasks[task];
+    }
+    if (extra >= 0)
+        set->buffer[k++] = tasks[extra];
+
+    if (test == CORE_TEST_EDF) {
+        DemandResult demand;
+        return processor_demand_test(set->buffer, n, &demand) == 1;
+    }
+
+    TaskResponse *responses = check_alloc(malloc(sizeof(TaskResponse) * n));
+    int status = response_time_analysis(set->buffer, n,
+                                        PRIORITY_RATE_MONOTONIC, responses);
+    free(responses);
+    return status == 1;
+}
+
+// 이용률 내림차순으로 태스크를 하나씩 fit 방식으로 배정 (모두 들어가면 1)
+// 어느 코어에도 들어가지 못한 태스크는 이용률이 가장 낮은 코어에 두고,
+// stop_on_failure면 그 자리에서 멈춘다
+static int pack_tasks(CoreSet *set, const Process *tasks, int count,
+                      PartitionFit fit, CoreTest test, int *assignment,
+                      int stop_on_failure) {
+    TaskLoad *order =
+        check_alloc(malloc(sizeof(TaskLoad) * (count > 0 ? count : 1)));
+    for (int i = 0; i < count; i++) {
+        order[i].index = i;
+        order[i].utilization = task_utilization(&tasks[i]);
+    }
+    qsort(order, count, sizeof(TaskLoad), compare_load);
+
+    int fits = 1;
+    for (int i = 0; i < count; i++) {
+        int task = order[i].index;
+        int chosen = -1;
+        for (int c = 0; c < set->cores; c++) {
+            if (fit == PARTITION_BEST_FIT && chosen != -1 &&
+                set->load[c] <= set->load[chosen])
+                continue;
+            if (fit == PARTITION_WORST_FIT && chosen != -1 &&
+                set->load[c] >= set->load[chosen])
+                continue;
+            if (!core_accepts(set, tasks, c, task, test))
+                continue;
+            chosen = c;
+            if (fit == PARTITION_FIRST_FIT)
+                break;
+        }
+
+        if (chosen == -1) {
+            fits = 0;
+            if (stop_on_failure)
+                break;
+            chosen = 0;
+            for (int c = 1; c < set->cores; c++) {
+                if (set->load[c] < set->load[chosen])
+                    chosen = c;
+            }
+        }
+        if (assignment)
+            assignment[task] = chosen;
+        assign_task(set, tasks, chosen, task);
+    }
+
+    free(order);
+    return fits;
+}
+
+static int has_periods(const Process *tasks, int count) {
+    for (int i = 0; i < count; i++) {
+        if (tasks[i].period <= 0)
+            return 0;
+    }
+    return 1;
+}
+
+// 태스크를 cores개 코어에 배정하고 assignment[i]에 태스크 i의 코어를 기록
+// 모든 코어가 검사를 통과하면 1, 아니면 0 (bin-packing에서 어느 코어에도
+// 들어가지 못한 태스크는 이용률이 가장 낮은 코어에 둔다)
+// 주기가 없는 태스크가 있으면 태스크 번호 순서로 배정하고 -1
+int partition_tasks(const Process *tasks, int count, int cores,
+                    PartitionFit fit, CoreTest test, int *assignment) {
+    if (fit == PARTITION_ROUND_ROBIN || !has_periods(tasks, count)) {
+        for (int i = 0; i < count; i++) {
+            assignment[i] = i % cores;
+        }
+        if (!has_periods(tasks, count))
+            return -1;
+    }
+
+    CoreSet set;
+    init_core_set(&set, count, cores);
+    int fits = 1;
+    if (fit == PARTITION_ROUND_ROBIN) {
+        for (int i = 0; i < count; i++) {
+            assign_task(&set, tasks, assignment[i], i);
+        }
+        for (int c = 0; c < cores && fits; c++) {
+            fits = core_accepts(&set, tasks, c, -1, test);
+        }
+    } else {
+        fits = pack_tasks(&set, tasks, count, fit, test, assignment, 0);
+    }
+    free_core_set(&set);
+    return fits;
+}
+
+// 모든 코어가 검사를 통과하는 가장 적은 코어 수
+// (태스크 하나만으로도 통과하지 못하거나 주기가 없으면 -1)
+//
+// first/best-fit은 빈 코어를 번호 순서로 처음 쓸 때만 열기 때문에, 코어
+// 수에 제한이 없을 때 쓴 코어 수가 곧 최소 코어 수다. worst-fit은 코어
+// 수에 따라 배정이 달라지므로 이용률 합의 올림부터 차례로 시도한다
+int minimum_partition_cores(const Process *tasks, int count, PartitionFit fit,
+                            CoreTest test) {
+    if (count == 0)
+        return 0;
+    if (!has_periods(tasks, count))
+        return -1;
+
+    CoreSet single;
+    init_core_set(&single, count, 1);
+    int alone = 1;
+    for (int i = 0; i < count && alone; i++) {
+        alone = core_accepts(&single, tasks, 0, i, test);
+    }
+    free_core_set(&single);
+    if (!alone)
+        return -1;
+
+    if (fit != PARTITION_WORST_FIT) {
+        CoreSet set;
+        init_core_set(&set, count, count);
+        int found = -1;
+        if (pack_tasks(&set, tasks, count, fit, test, NULL, 1)) {
+            found = 0;
+            while (found < count && set.member_count[found] > 0)
+                found++;
+        }
+        free_core_set(&set);
+        return found;
+    }
+
+    // 코어 수는 전체 이용률보다 적을 수 없다
+    double total = 0.0;
+    for (int i = 0; i < count; i++) {
+        total += task_utilization(&tasks[i]);
+    }
+    int start = (int)ceil(total - UTILIZATION_EPSILON);
+    if (start < 1)
+        start = 1;
+
+    int found = -1;
+    for (int cores = start; cores <= count && found == -1; cores++) {
+        CoreSet set;
+        init_core_set(&set, count, cores);
+        if (pack_tasks(&set, tasks, count, fit, test, NULL, 1))
+            found = cores;
+        free_core_set(&set);
+    }
+    return found;
+}
+
+const char *partition_fit_name(PartitionFit fit) {
+    switch (fit) {
+    case PARTITION_ROUND_ROBIN:
+        return "Round-Robin";
+    case PARTITION_FIRST_FIT:
+        return "First-Fit Decreasing";
+    case PARTITION_BEST_FIT:
+        return "Best-Fit Decreasing";
+    case PARTITION_WORST_FIT:
+        return "Worst-Fit Decreasing";
+    }
+    return "";
+}
+
+static const char *core_test_name(CoreTest test) {
+    return test == CORE_TEST_RMS ? "RMS" : "EDF";
+}
+
+// 코어별 배정 결과 표 (core_misses가 있으면 시뮬레이션 미스 수도 표시)
+void print_partition_table(const Process *tasks, int count, int cores,
+                           PartitionFit fit, CoreTest test,
+                           const int *core_misses) {
+    int *assignment =
+        check_alloc(malloc(sizeof(int) * (count > 0 ? count : 1)));
+    int status = partition_tasks(tasks, count, cores, fit, test, assignment);
+
+    CoreSet set;
+    init_core_set(&set, count, cores);
+    for (int i = 0; i < count; i++) {
+        assign_task(&set, tasks, assignment[i], i);
+    }
+
+    printf("\n** Task Partitioning (%s, %s per Core) **\n",
+           partition_fit_name(fit), core_test_name(test));
+    printf("+------+-------+---------------+-----------------+--------+\n");
+    printf("| Core | Tasks | Utilization %% | Analysis        | Missed |\n");
+    printf("+------+-------+---------------+-----------------+--------+\n");
+    for (int c = 0; c < cores; c++) {
+        const char *verdict = "UNKNOWN";
+        if (status >= 0) {
+            verdict = core_accepts(&set, tasks, c, -1, test)
+                          ? "SCHEDULABLE"
+                          : "NOT SCHEDULABLE";
+        }
+        char missed[16] = "-";
+        if (core_misses)
+            snprintf(missed, sizeof(missed), "%d", core_misses[c]);
+        printf("| %-4d | %-5d | %-13.2f | %-15s | %-6s |\n", c,
+               set.member_count[c], set.load[c] * 100, verdict, missed);
+    }
+    printf("+------+-------+---------------+-----------------+--------+\n");
+
+    for (int c = 0; c < cores; c++) {
+        printf("- Core %d:", c);
+        for (int task = set.first[c]; task != -1; task = set.next[task]) {
+            printf(" P%d", tasks[task].pid);
+        }
+        printf("\n");
+    }
+    if (status == 0)
+        printf("- Task set does not fit on %d cores\n", cores);
+
+    int minimum = minimum_partition_cores(tasks, count, fit, test);
+    if (minimum > 0)
+        printf("- Minimum cores (%s): %d\n", partition_fit_name(fit), minimum);
+
+    free_core_set(&set);
+    free(assignment);
+}
+
+// 방식별로 모든 코어가 검사를 통과하는 최소 코어 수
+void print_minimum_cores(const Process *tasks, int count) {
+    printf("** Minimum Cores for Partitioned Scheduling **\n");
+    printf("+----------------------+----------+----------+\n");
+    printf("| Heuristic            | EDF      | RMS      |\n");
+    printf("+----------------------+----------+----------+\n");
+    for (int i = 0; i < BIN_PACKING_FIT_COUNT; i++) {
+        PartitionFit fit = bin_packing_fits[i];
+        char edf[16] = "-";
+        char rms[16] = "-";
+        int edf_cores =
+            minimum_partition_cores(tasks, count, fit, CORE_TEST_EDF);
+        int rms_cores =
+            minimum_partition_cores(tasks, count, fit, CORE_TEST_RMS);
+        if (edf_cores >= 0)
+            snprintf(edf, sizeof(edf), "%d", edf_cores);
+        if (rms_cores >= 0)
+            snprintf(rms, sizeof(rms), "%d", rms_cores);
+        printf("| %-20s | %-8s | %-8s |\n", partition_fit_name(fit), edf, rms);
+    }
+    printf("+----------------------+----------+----------+\n");
+    printf("- \"-\": some task misses its deadline even on its own core\n");
+    printf("\n");
+}
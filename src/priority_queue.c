@@ -0,0 +1,168 @@
+#include "priority_queue.h"
+#include <stdlib.h>
+
+// pid1이 pid2보다 앞서면 음수
+int pq_compare(PriorityQueue *pq, int pid1, int pid2) {
+    if (pq->keys[pid1] != pq->keys[pid2])
+        return pq->keys[pid1] < pq->keys[pid2] ? -1 : 1;
+    if (pq->sequence[pid1] != pq->sequence[pid2])
+        return pq->sequence[pid1] < pq->sequence[pid2] ? -1 : 1;
+    return 0;
+}
+
+static void place(PriorityQueue *pq, int index, int pid) {
+    pq->heap[index] = pid;
+    pq->position[pid] = index;
+}
+
+static void sift_up(PriorityQueue *pq, int index) {
+    int pid = pq->heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (pq_compare(pq, pid, pq->heap[parent]) >= 0)
+            break;
+        place(pq, index, pq->heap[parent]);
+        index = parent;
+    }
+    place(pq, index, pid);
+}
+
+static void sift_down(PriorityQueue *pq, int index) {
+    int pid = pq->heap[index];
+    while (1) {
+        int child = index * 2 + 1;
+        if (child >= pq->count)
+            break;
+        if (child + 1 < pq->count &&
+            pq_compare(pq, pq->heap[child + 1], pq->heap[child]) < 0)
+            child++;
+        if (pq_compare(pq, pq->heap[child], pid) >= 0)
+            break;
+        place(pq, index, pq->heap[child]);
+        index = child;
+    }
+    place(pq, index, pid);
+}
+
+// pid 범위가 늘어나면 (EDF/RMS 인스턴스) 인덱스 배열 확장
+static void ensure_pid(PriorityQueue *pq, int pid) {
+    if (pid < pq->pid_capacity)
+        return;
+
+    int new_capacity = pq->pid_capacity * 2;
+    if (new_capacity <= pid)
+        new_capacity = pid + 1;
+
+    pq->position = arena_realloc(pq->arena, pq->position,
+                                 sizeof(int) * pq->pid_capacity,
+                                 sizeof(int) * new_capacity);
+    pq->sequence = arena_realloc(pq->arena, pq->sequence,
+                                 sizeof(long) * pq->pid_capacity,
+                                 sizeof(long) * new_capacity);
+    for (int i = pq->pid_capacity; i < new_capacity; i++) {
+        pq->position[i] = -1;
+        pq->sequence[i] = 0;
+    }
+    pq->pid_capacity = new_capacity;
+}
+
+void init_priority_queue(PriorityQueue *pq, const int *keys,
+                         int pid_capacity, Arena *arena) {
+    if (pid_capacity < 1)
+        pid_capacity = 1;
+
+    pq->arena = arena;
+    pq->capacity = pid_capacity;
+    pq->heap = (int *)arena_alloc(arena, sizeof(int) * pq->capacity);
+    pq->count = 0;
+    pq->pid_capacity = pid_capacity;
+    pq->position = (int *)arena_alloc(arena, sizeof(int) * pid_capacity);
+    pq->sequence = (long *)arena_alloc(arena, sizeof(long) * pid_capacity);
+    for (int i = 0; i < pid_capacity; i++) {
+        pq->position[i] = -1;
+        pq->sequence[i] = 0;
+    }
+    pq->next_sequence = 0;
+    pq->keys = keys;
+}
+
+void free_priority_queue(PriorityQueue *pq) {
+    arena_free(pq->arena, pq->heap);
+    arena_free(pq->arena, pq->position);
+    arena_free(pq->arena, pq->sequence);
+    pq->heap = NULL;
+    pq->position = NULL;
+    pq->sequence = NULL;
+    pq->count = 0;
+}
+
+int pq_is_empty(PriorityQueue *pq) {
+    return (pq->count == 0);
+}
+
+int pq_contains(PriorityQueue *pq, int pid) {
+    return pid >= 0 && pid < pq->pid_capacity && pq->position[pid] != -1;
+}
+
+void pq_push(PriorityQueue *pq, int pid) {
+    ensure_pid(pq, pid);
+    if (pq->count == pq->capacity) {
+        pq->heap = arena_realloc(pq->arena, pq->heap,
+                                 sizeof(int) * pq->capacity,
+                                 sizeof(int) * pq->capacity * 2);
+        pq->capacity *= 2;
+    }
+
+    pq->sequence[pid] = pq->next_sequence++;
+    place(pq, pq->count++, pid);
+    sift_up(pq, pq->count - 1);
+}
+
+int pq_pop(PriorityQueue *pq) {
+    if (pq_is_empty(pq))
+        return -1;
+
+    int top = pq->heap[0];
+    pq->position[top] = -1;
+    pq->count--;
+    if (pq->count > 0) {
+        place(pq, 0, pq->heap[pq->count]);
+        sift_down(pq, 0);
+    }
+    return top;
+}
+
+int pq_peek(PriorityQueue *pq) {
+    if (pq_is_empty(pq))
+        return -1;
+    return pq->heap[0];
+}
+
+// 큐 안에 있는 프로세스의 키가 바뀐 뒤 호출 (aging 등)
+// 키가 바뀐 시점 순서로 동점을 처리하도록 순번을 새로 부여한다
+void pq_update(PriorityQueue *pq, int pid) {
+    if (!pq_contains(pq, pid))
+        return;
+
+    pq->sequence[pid] = pq->next_sequence++;
+    int index = pq->position[pid];
+    sift_up(pq, index);
+    sift_down(pq, pq->position[pid]);
+}
+
+// 큐 안에 있는 프로세스를 빼냄 (작업 훔치기 등)
+void pq_remove(PriorityQueue *pq, int pid) {
+    if (!pq_contains(pq, pid))
+        return;
+
+    int index = pq->position[pid];
+    pq->position[pid] = -1;
+    pq->count--;
+    if (index == pq->count)
+        return;
+
+    int moved = pq->heap[pq->count];
+    place(pq, index, moved);
+    sift_up(pq, index);
+    sift_down(pq, pq->position[moved]);
+}
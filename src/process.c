@@ -5,21 +5,182 @@
 #include <string.h>
 #include <time.h>
 #include "utils.h"
+#include "workload.h"
 #define MAX_FILES 100
+#define RANDOM_MAX_IO 3 // 랜덤 생성 시 프로세스당 최대 I/O 수
 
 
 // 프로세스의 I/O 작업 초기화
 void init_process_io(Process *p) {
-    for (int i = 0; i < MAX_IO_OPERATIONS; i++) {
-        p->io_operations[i].io_start = -1;
-        p->io_operations[i].io_burst = 0;
+    p->io_operations = NULL;
+    p->io_count = 0;
+}
+
+
+
+// PID가 0 ~ count-1이면 제자리에서 processes[pid] 위치로 옮김 (O(n))
+// 같은 PID를 만나면 -1
+static int place_dense_pids(Process *processes, int count) {
+    for (int i = 0; i < count; i++) {
+        while (processes[i].pid != i) {
+            int target = processes[i].pid;
+            if (processes[target].pid == target) {
+                printf("Duplicate PID %d in workload\n", target);
+                return -1;
+            }
+            Process temp = processes[target];
+            processes[target] = processes[i];
+            processes[i] = temp;
+        }
     }
+    return 0;
 }
 
+// PID 범위가 듬성듬성한 경우: 인덱스 배열을 16비트씩 두 번 기수 정렬한 뒤
+// 한 번에 재배치 (O(n), 구조체는 한 번만 복사)
+static int radix_sort_pids(Process *processes, int count) {
+    int *order = malloc(sizeof(int) * count);
+    int *scratch = malloc(sizeof(int) * count);
+    int *buckets = malloc(sizeof(int) * ((1 << 16) + 1));
+    if (!order || !scratch || !buckets) {
+        perror("pid sort");
+        exit(1);
+    }
+
+    for (int i = 0; i < count; i++)
+        order[i] = i;
+
+    for (int shift = 0; shift < 32; shift += 16) {
+        memset(buckets, 0, sizeof(int) * ((1 << 16) + 1));
+        for (int i = 0; i < count; i++) {
+            unsigned digit = ((unsigned)processes[i].pid >> shift) & 0xFFFF;
+            buckets[digit + 1]++;
+        }
+        for (int d = 0; d < (1 << 16); d++)
+            buckets[d + 1] += buckets[d];
+        for (int i = 0; i < count; i++) {
+            unsigned digit =
+                ((unsigned)processes[order[i]].pid >> shift) & 0xFFFF;
+            scratch[buckets[digit]++] = order[i];
+        }
+        int *swap = order;
+        order = scratch;
+        scratch = swap;
+    }
+
+    int status = 0;
+    for (int i = 1; i < count; i++) {
+        if (processes[order[i]].pid == processes[order[i - 1]].pid) {
+            printf("Duplicate PID %d in workload\n", processes[order[i]].pid);
+            status = -1;
+            break;
+        }
+    }
+
+    if (status == 0) {
+        Process *sorted = malloc(sizeof(Process) * count);
+        if (!sorted) {
+            perror("pid sort");
+            exit(1);
+        }
+        for (int i = 0; i < count; i++)
+            sorted[i] = processes[order[i]];
+        memcpy(processes, sorted, sizeof(Process) * count);
+        free(sorted);
+    }
+
+    free(order);
+    free(scratch);
+    free(buckets);
+    return status;
+}
+
+// PID 기준으로 정렬하고 검증 (정상 0, 잘못된 PID -1)
+// 스케줄러는 배열 위치를 프로세스 번호로 쓰므로 PID는 0 ~ count-1이어야
+// 결과의 번호와 일치한다. 음수나 중복 PID는 오류, 빈 번호가 있으면 경고
+int order_processes_by_pid(Process *processes, int count) {
+    int dense = 1;
+    for (int i = 0; i < count; i++) {
+        if (processes[i].pid < 0) {
+            printf("Invalid PID %d (process %d): PIDs must not be negative\n",
+                   processes[i].pid, i);
+            return -1;
+        }
+        if (processes[i].pid >= count)
+            dense = 0;
+    }
+
+    if (dense)
+        return place_dense_pids(processes, count);
+
+    if (radix_sort_pids(processes, count) != 0)
+        return -1;
+
+    printf("Warning: PIDs are not contiguous (0 ~ %d expected); processes "
+           "are numbered by PID order in the results\n",
+           count - 1);
+    return 0;
+}
+
+// 프로세스 설정 파일 읽기 (실패 시 NULL)
+Process *load_processes_from_file(const char *filepath, int *count) {
+    WorkloadReader reader;
+    if (open_workload(&reader, filepath) != 0)
+        return NULL;
+
+    Process *processes =
+        (Process *)malloc(sizeof(Process) * reader.declared_count);
+    if (!processes) {
+        perror("malloc error");
+        close_workload(&reader);
+        return NULL;
+    }
+
+    // 각 프로세스 정보 읽기 (I/O는 공유 배열에 차례로 모음)
+    IOArena arena;
+    init_io_arena(&arena, reader.io_count);
+
+    int status;
+    int n = 0;
+    while ((status = read_workload_process(&reader, &processes[n])) == 1) {
+        append_io_operations(&arena, processes[n].io_operations,
+                             processes[n].io_count);
+        n++;
+    }
+    close_workload(&reader);
+
+    if (status < 0) {
+        free_io_arena(&arena);
+        free(processes);
+        return NULL;
+    }
+
+    Process *block = attach_io_arena(processes, n, &arena);
+    if (!block) {
+        free_io_arena(&arena);
+        free(processes);
+        return NULL;
+    }
+    processes = block;
+
+    *count = n;
+
+    if (order_processes_by_pid(processes, *count) != 0) {
+        free(processes);
+        return NULL;
+    }
 
+    return processes;
+}
 
 Process *create_processes(int *count, char mode) {
-    Process *processes = (Process *)malloc(sizeof(Process) * *count);
+    Process *processes = NULL;
+    IOArena arena;
+
+    if (mode == 'y' || mode == 'n') {
+        processes = (Process *)malloc(sizeof(Process) * *count);
+        init_io_arena(&arena, 0);
+    }
 
     if (mode == 'y') {
         // 랜덤 모드
@@ -34,12 +195,12 @@ Process *create_processes(int *count, char mode) {
             init_process_io(&processes[i]);
 
             // 랜덤으로 0-3개의 I/O 작업 생성
-            int io_count = rand() % 4; // 0, 1, 2, 3개 중 랜덤
+            int io_count = rand() % (RANDOM_MAX_IO + 1); // 0 ~ 3개 중 랜덤
             printf(" - Process P%d: CPU %d, I/O count: %d\n", i,
                    processes[i].cpu_burst, io_count);
 
             // I/O 시작 시간들을 저장할 배열 (중복 방지용)
-            int used_start_times[MAX_IO_OPERATIONS];
+            int used_start_times[RANDOM_MAX_IO];
             int used_count = 0;
 
             for (int j = 0; j < io_count; j++) {
@@ -70,7 +231,8 @@ Process *create_processes(int *count, char mode) {
                         used_start_times[used_count++] = start_time;
                         duration = rand() % 5 + 1;
 
-                        add_io_to_process(&processes[i], start_time, duration);
+                        add_io_to_process(&arena, &processes[i], start_time,
+                                          duration);
 
                         printf("    I/O %d: Start at %d, Duration %d\n", j + 1,
                                start_time, duration);
@@ -82,12 +244,14 @@ Process *create_processes(int *count, char mode) {
                 }
             }
 
-            sort_io_operations(&processes[i]);
+            IOOperation *ops =
+                &arena.ops[arena.count - processes[i].io_count];
+            sort_io_operations(ops, processes[i].io_count);
 
             int total_io_time = 0;
-            for (int j = 0; j < io_count; j++) {
-                if (processes[i].io_operations[j].io_start > 0) {
-                    total_io_time += processes[i].io_operations[j].io_burst;
+            for (int j = 0; j < processes[i].io_count; j++) {
+                if (ops[j].io_start > 0) {
+                    total_io_time += ops[j].io_burst;
                 }
             }
 
@@ -125,14 +289,6 @@ Process *create_processes(int *count, char mode) {
                 (float)actual_execution_time / processes[i].period * 100);
 
             processes[i].priority = rand() % 10 + 1;
-
-            processes[i].missed_deadline = 0;
-            processes[i].remaining_time = processes[i].cpu_burst;
-            processes[i].progress = 0;
-            processes[i].comp_time = 0;
-            processes[i].waiting_time = 0;
-            processes[i].turnaround_time = 0;
-            processes[i].waiting_time_counter = 0;
         }
 
     } else if (mode == 'n') {
@@ -165,13 +321,11 @@ Process *create_processes(int *count, char mode) {
 
             // I/O 작업 개수 입력
             int io_count;
-            printf("  Number of I/O operations (0-%d): ", MAX_IO_OPERATIONS);
+            printf("  Number of I/O operations: ");
             scanf("%d", &io_count);
 
             if (io_count < 0)
                 io_count = 0;
-            if (io_count > MAX_IO_OPERATIONS)
-                io_count = MAX_IO_OPERATIONS;
 
             // 각 I/O 작업 정보 입력
             for (int j = 0; j < io_count; j++) {
@@ -184,17 +338,10 @@ Process *create_processes(int *count, char mode) {
                 printf("    Burst time: ");
                 scanf("%d", &io_burst);
 
-                add_io_to_process(&processes[i], io_start, io_burst);
+                add_io_to_process(&arena, &processes[i], io_start, io_burst);
             }
 
-            processes[i].missed_deadline = 0;
-            processes[i].remaining_time = processes[i].cpu_burst;
-            processes[i].progress = 0;
-            processes[i].comp_time = 0;
-            processes[i].waiting_time = 0;
-            processes[i].turnaround_time = 0;
-            processes[i].waiting_time_counter = 0;
-            sort_io_operations(&processes[i]);
+            sort_io_operations(&arena.ops[arena.count - io_count], io_count);
         }
 
     } else {
@@ -212,8 +359,10 @@ Process *create_processes(int *count, char mode) {
 
         while ((entry = readdir(dir)) != NULL) {
             if (strncmp(entry->d_name, "process-", 8) == 0) {
-                char *ext = strstr(entry->d_name, ".txt");
-                if (ext && strcmp(ext, ".txt") == 0) {
+                // 텍스트(.txt) 또는 바이너리(.bin) 워크로드
+                char *ext = strrchr(entry->d_name, '.');
+                if (ext && (strcmp(ext, ".txt") == 0 ||
+                            strcmp(ext, ".bin") == 0)) {
                     filenames[count_files] = strdup(entry->d_name);
                     count_files++;
                     if (count_files >= MAX_FILES)
@@ -245,101 +394,26 @@ Process *create_processes(int *count, char mode) {
         char filepath[256];
         snprintf(filepath, sizeof(filepath), "test_files/%s",
                  filenames[choice - 1]);
-        FILE *file = fopen(filepath, "r");
-
-        if (!file) {
-            printf("Cannot open file: %s\n", filepath);
-            return NULL;
-        }
-
-        // 프로세스 개수 먼저 읽기
-        int real_count = 0;
-        if (fscanf(file, "%d", &real_count) != 1) {
-            printf("Failed to read process count from file.\n");
-            fclose(file);
-            return NULL;
-        }
-
-        processes = (Process *)malloc(sizeof(Process) * real_count);
-        if (!processes) {
-            perror("malloc error");
-            fclose(file);
-            return NULL;
-        }
-
-        *count = real_count;
-
-        // 각 프로세스 정보 읽기
-        for (int i = 0; i < *count; i++) {
-            int io_count;
-
-            // 기본 프로세스 정보 읽기
-            if (fscanf(file, "%d %d %d %d %d %d %d", &processes[i].pid,
-                       &processes[i].arrival_time, &processes[i].cpu_burst,
-                       &processes[i].priority, &processes[i].deadline,
-                       &processes[i].period, &io_count) != 7) {
-                printf("Failed to read process %d basic info from file.\n", i);
-                fclose(file);
-                return NULL;
-            }
-
-            // I/O 배열 초기화
-            init_process_io(&processes[i]);
-
-            // I/O 작업들 읽기
-            for (int j = 0; j < io_count && j < MAX_IO_OPERATIONS; j++) {
-                int io_start, io_burst;
-
-                if (fscanf(file, "%d %d", &io_start, &io_burst) != 2) {
-                    printf("Failed to read I/O %d info for process %d from "
-                           "file.\n",
-                           j, i);
-                    fclose(file);
-                    return NULL;
-                }
-
-                add_io_to_process(&processes[i], io_start, io_burst);
-            }
-
-            processes[i].missed_deadline = 0;
-            processes[i].remaining_time = processes[i].cpu_burst;
-            processes[i].progress = 0;
-            processes[i].comp_time = 0;
-            processes[i].waiting_time = 0;
-            processes[i].turnaround_time = 0;
-            processes[i].waiting_time_counter = 0;
-            sort_io_operations(&processes[i]);
-        }
-
-        fclose(file);
+        processes = load_processes_from_file(filepath, count);
 
         for (int i = 0; i < count_files; i++) {
             free(filenames[i]);
         }
+        return processes;
     }
 
-    // PID 기준으로 정렬
-    for (int i = 0; i < *count - 1; i++) {
-        for (int j = 0; j < *count - i - 1; j++) {
-            if (processes[j].pid > processes[j + 1].pid) {
-                Process temp = processes[j];
-                processes[j] = processes[j + 1];
-                processes[j + 1] = temp;
-            }
-        }
+    Process *block = attach_io_arena(processes, *count, &arena);
+    if (!block) {
+        free_io_arena(&arena);
+        free(processes);
+        return NULL;
     }
+    processes = block;
 
-    return processes;
-}
-
-void reset_processes(Process *processes, int count) {
-    for (int i = 0; i < count; i++) {
-        processes[i].remaining_time = processes[i].cpu_burst;
-        processes[i].progress = 0;
-        processes[i].comp_time = 0;
-        processes[i].waiting_time = 0;
-        processes[i].turnaround_time = 0;
-        processes[i].waiting_time_counter = 0;
-        processes[i].missed_deadline = 0;
+    if (order_processes_by_pid(processes, *count) != 0) {
+        free(processes);
+        return NULL;
     }
+
+    return processes;
 }
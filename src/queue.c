@@ -1,6 +1,28 @@
 #include "queue.h"
+#include <stdlib.h>
 
 void init_queue(Queue *q) {
+    init_queue_with_capacity(q, QUEUE_DEFAULT_CAPACITY, NULL);
+}
+
+// capacity: 예상 최대 원소 수 (넘어가면 자동으로 늘어남)
+// arena: 버퍼를 할당할 arena (NULL이면 일반 힙)
+void init_queue_with_capacity(Queue *q, int capacity, Arena *arena) {
+    if (capacity < 1)
+        capacity = QUEUE_DEFAULT_CAPACITY;
+
+    q->arena = arena;
+    q->data = (int *)arena_alloc(arena, sizeof(int) * capacity);
+    q->capacity = capacity;
+    q->front = 0;
+    q->rear = 0;
+    q->count = 0;
+}
+
+void free_queue(Queue *q) {
+    arena_free(q->arena, q->data);
+    q->data = NULL;
+    q->capacity = 0;
     q->front = 0;
     q->rear = 0;
     q->count = 0;
@@ -10,22 +32,44 @@ int is_empty(Queue *q) {
     return (q->count == 0);
 }
 
+// 현재 할당된 공간이 가득 찼는지 (다음 enqueue에서 확장됨)
 int is_full(Queue *q) {
-    return (q->count == MAX_QUEUE_SIZE);
+    return (q->count == q->capacity);
 }
 
-void enqueue(Queue *q, int value) {
-    if (!is_full(q)) {
-        q->data[q->rear] = value;
-        q->rear = (q->rear + 1) % MAX_QUEUE_SIZE;
-        q->count++;
+// 원소들을 순서대로 새 배열로 옮기면서 용량을 두 배로 늘림
+static int grow_queue(Queue *q) {
+    int new_capacity = q->capacity > 0 ? q->capacity * 2 : QUEUE_DEFAULT_CAPACITY;
+    int *new_data = (int *)arena_alloc(q->arena, sizeof(int) * new_capacity);
+
+    for (int i = 0; i < q->count; i++) {
+        new_data[i] = q->data[(q->front + i) % q->capacity];
     }
+
+    arena_free(q->arena, q->data);
+    q->data = new_data;
+    q->capacity = new_capacity;
+    q->front = 0;
+    q->rear = q->count;
+    return 0;
+}
+
+// 성공하면 0, 공간을 늘릴 수 없으면 -1 (원소를 버리지 않음)
+int enqueue(Queue *q, int value) {
+    if (is_full(q) && grow_queue(q) != 0) {
+        return -1;
+    }
+
+    q->data[q->rear] = value;
+    q->rear = (q->rear + 1) % q->capacity;
+    q->count++;
+    return 0;
 }
 
 int dequeue(Queue *q) {
     if (!is_empty(q)) {
         int value = q->data[q->front];
-        q->front = (q->front + 1) % MAX_QUEUE_SIZE;
+        q->front = (q->front + 1) % q->capacity;
         q->count--;
         return value;
     }
@@ -38,3 +82,18 @@ int peek(Queue *q) {
     }
     return -1;
 }
+
+// 앞에서 index번째 원소를 꺼냄 (나머지 순서는 유지, 없으면 -1)
+int queue_remove_at(Queue *q, int index) {
+    if (index < 0 || index >= q->count)
+        return -1;
+
+    int value = q->data[(q->front + index) % q->capacity];
+    for (int i = index; i + 1 < q->count; i++) {
+        q->data[(q->front + i) % q->capacity] =
+            q->data[(q->front + i + 1) % q->capacity];
+    }
+    q->rear = (q->rear - 1 + q->capacity) % q->capacity;
+    q->count--;
+    return value;
+}
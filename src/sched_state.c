@@ -0,0 +1,62 @@
+#include "sched_state.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void *grow_array(void *array, size_t size, int capacity) {
+    array = realloc(array, size * capacity);
+    if (!array) {
+        perror("scheduling state");
+        exit(1);
+    }
+    return array;
+}
+
+void init_sched_state(SchedState *state, int capacity) {
+    memset(state, 0, sizeof(SchedState));
+    init_arena(&state->scratch);
+    grow_sched_state(state, capacity < 1 ? 1 : capacity);
+}
+
+// 배열 크기를 capacity로 늘림 (기존 값 유지)
+// 새 슬롯의 stamp는 0이므로 현재 실행에서 처음 사용할 때 초기화된다
+void grow_sched_state(SchedState *state, int capacity) {
+    if (capacity <= state->capacity)
+        return;
+
+    state->key = grow_array(state->key, sizeof(int), capacity);
+    state->progress = grow_array(state->progress, sizeof(int), capacity);
+    state->io_cursor = grow_array(state->io_cursor, sizeof(int), capacity);
+    state->ready_since =
+        grow_array(state->ready_since, sizeof(int), capacity);
+    state->waiting = grow_array(state->waiting, sizeof(int), capacity);
+    state->outcome =
+        grow_array(state->outcome, sizeof(ProcessOutcome), capacity);
+    state->stamp = grow_array(state->stamp, sizeof(unsigned), capacity);
+    memset(&state->stamp[state->capacity], 0,
+           sizeof(unsigned) * (capacity - state->capacity));
+    state->capacity = capacity;
+}
+
+// 새 실행 시작: 이전 실행의 슬롯은 모두 초기화 전 상태로 취급
+// 이전 실행이 scratch에 남긴 버퍼(간트차트 등)도 여기서 무효가 된다
+void begin_sched_run(SchedState *state) {
+    reset_arena(&state->scratch);
+    if (++state->generation == 0) {
+        // 실행 번호가 한 바퀴 돌면 stamp를 지우고 1부터 다시 시작
+        memset(state->stamp, 0, sizeof(unsigned) * state->capacity);
+        state->generation = 1;
+    }
+}
+
+void free_sched_state(SchedState *state) {
+    free(state->key);
+    free(state->progress);
+    free(state->io_cursor);
+    free(state->ready_since);
+    free(state->waiting);
+    free(state->outcome);
+    free(state->stamp);
+    free_arena(&state->scratch);
+    memset(state, 0, sizeof(SchedState));
+}
@@ -1,1245 +1,200 @@
 #include "scheduler.h"
 #include "evaluation.h"
+#include "parallel.h"
+#include "partition.h"
 #include "queue.h"
 #include "utils.h"
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#define GanttEntrySize 1000
 
-
-Metrics *run_fcfs(Process *processes, int count) {
-    printf("\n");
-    print_thin_emphasized_header("FCFS Scheduling with Multi-I/O", 150);
-    printf("\n");
-
-    Metrics *metrics;
-    metrics = malloc(sizeof(Metrics));
-
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-
-    int *waiting_q = (int *)malloc(sizeof(int) * count);
-    for (int i = 0; i < count; i++) {
-        waiting_q[i] = -1;
-    }
-
-    int time = 0;
-    int completed = 0;
-    int idle_time = 0;
-    int pick = -1;
-
-    while (completed < count) {
-        for (int i = 0; i < count; i++) {
-            // 도착 프로세스 처리
-            if (processes[i].arrival_time == time) {
-                enqueue(&ready_q, i);
-            }
-
-            // I/O 완료 처리
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    enqueue(&ready_q, i);
-                    waiting_q[i] = -1;
-                }
-            }
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            pick = dequeue(&ready_q);
-            enqueue(&running_q, pick);
-        }
-
-        // 프로세스 실행 및 상태 변경
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            add_gantt_entry(&gantt, time, time + 1, pick, "RUN");
-            processes[pick].progress++;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&processes[pick],
-                                   processes[pick].progress)) {
-                int waiting = dequeue(&running_q);
-                int io_burst = get_io_burst_at_progress(
-                    &processes[waiting], processes[waiting].progress);
-                waiting_q[waiting] = io_burst + 1;
-
-            } else if (processes[pick].progress == processes[pick].cpu_burst) {
-                // 프로세스 완료
-                int finished = dequeue(&running_q);
-                processes[finished].comp_time = time + 1;
-                processes[finished].turnaround_time =
-                    processes[finished].comp_time -
-                    processes[finished].arrival_time;
-                processes[finished].waiting_time =
-                    processes[finished].waiting_time_counter;
-
-                completed++;
-            }
-        }
-
-        // 대기 큐 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    processes[pid].waiting_time_counter++;
-                }
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력 (간소화)
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue: ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d ", pid);
-        //     }
-        //     printf("\n");
-        // }
-
-        time++;
-    }
-
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-
-    // printf("\nScheduling completed at time %d\n", time);
-    // printf("Total idle time: %d\n", idle_time);
-
-    display_scheduling_results(processes, count, &gantt, time, idle_time,
-                               "FCFS Multi-I/O");
-
-    free(gantt.entries);
-    free(waiting_q);
-
-    return metrics;
+static int is_real_time_policy(SchedulingPolicy policy) {
+    return policy == POLICY_RMS || policy == POLICY_EDF;
 }
 
-Metrics *run_sjf_np(Process *processes, int count) {
-    printf("\n");
-    print_thin_emphasized_header("Non-Preemptive SJF Scheduling with Multi-I/O",
-                                 150);
-    printf("\n");
-
-    Metrics *metrics;
-    metrics = malloc(sizeof(Metrics));
-
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q, temp_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-    init_queue(&temp_q);
-
-    int *waiting_q = (int *)malloc(sizeof(int) * count);
-    for (int i = 0; i < count; i++) {
-        waiting_q[i] = -1;
-    }
-
-    int time = 0;
-    int completed = 0;
-    int idle_time = 0;
-    int pick = -1;
-
-    while (completed < count) {
-        // 도착 프로세스 처리 및 I/O 완료 처리
-        for (int i = 0; i < count; i++) {
-            // 도착 프로세스 처리
-            if (processes[i].arrival_time == time) {
-                enqueue(&ready_q, i);
-            }
-
-            // I/O 완료 처리
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    enqueue(&ready_q, i);
-                    waiting_q[i] = -1;
-                }
-            }
-        }
-
-        // Ready queue를 남은 실행시간 기준으로 정렬 (SJF)
-        if (!is_empty(&ready_q)) {
-            sort_queue(&ready_q, processes, SORT_BY_REMAINING_TIME);
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            pick = dequeue(&ready_q);
-            enqueue(&running_q, pick);
-        }
-
-        // 프로세스 실행 및 상태 변경
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            add_gantt_entry(&gantt, time, time + 1, pick, "RUN");
-            processes[pick].progress++;
-            processes[pick].remaining_time =
-                processes[pick].cpu_burst - processes[pick].progress;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&processes[pick],
-                                   processes[pick].progress)) {
-                int waiting = dequeue(&running_q);
-                int io_burst = get_io_burst_at_progress(
-                    &processes[waiting], processes[waiting].progress);
-                waiting_q[waiting] = io_burst + 1;
-
-            } else if (processes[pick].progress == processes[pick].cpu_burst) {
-                // 프로세스 완료
-                int finished = dequeue(&running_q);
-                processes[finished].comp_time = time + 1;
-                processes[finished].turnaround_time =
-                    processes[finished].comp_time -
-                    processes[finished].arrival_time;
-                processes[finished].waiting_time =
-                    processes[finished].waiting_time_counter;
-                completed++;
-            }
-        }
-
-        // 대기 큐 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    processes[pid].waiting_time_counter++;
-                }
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력 (간소화)
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue: ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(rem:%d) ", pid,
-        //                processes[pid].cpu_burst - processes[pid].progress);
-        //     }
-        //     printf("\n");
-        // }
-
-        time++;
-    }
-
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-
-    // printf("\nNon-Preemptive SJF scheduling completed at time %d\n", time);
-    // printf("Total idle time: %d\n", idle_time);
-
-    // 평균 통계 계산 및 출력
-    // double avg_waiting = 0, avg_turnaround = 0;
-    // for (int i = 0; i < count; i++) {
-    //     avg_waiting += processes[i].waiting_time;
-    //     avg_turnaround += processes[i].turnaround_time;
-    // }
-    // avg_waiting /= count;
-    // avg_turnaround /= count;
-
-    // printf("Average Waiting Time: %.2f\n", avg_waiting);
-    // printf("Average Turnaround Time: %.2f\n", avg_turnaround);
-
-    display_scheduling_results(processes, count, &gantt, time, idle_time,
-                               "Non-Preemptive SJF Multi-I/O");
-
-    free(gantt.entries);
-    free(waiting_q);
-
-    return metrics;
+// 출력 없이 시뮬레이션만 수행
+// 워크로드는 읽기만 하므로 state만 실행마다 다르면 여러 스레드에서 동시에
+// 호출할 수 있다 (aging 등 실행 중 바뀌는 값은 모두 state에 기록)
+void simulate_policy(SchedulingPolicy policy, const Process *processes,
+                     int count, Config *config, int max_time,
+                     SchedState *state, SimulationResult *result) {
+    int quantum = config ? config->time_quantum : 0;
+    int flags = 0;
+    if (!config || config->output_level != OUTPUT_METRICS)
+        flags |= SIM_DETAILED;
+    if (config && config->steady_state)
+        flags |= SIM_STEADY_STATE;
+    simulate(policy, processes, count, quantum, max_time, flags,
+             config ? &config->cpu : NULL, state, result);
 }
 
-Metrics *run_sjf_p(Process *processes, int count) {
-    printf("\n");
-    print_thin_emphasized_header("Preemptive SJF Scheduling with Multi-I/O",
-                                 150);
-    printf("\n");
-
-    Metrics *metrics;
-    metrics = malloc(sizeof(Metrics));
-
-    reset_processes(processes, count);
+typedef struct {
+    PolicyRun *runs;
+    const Process *workload;
+    int count;
+    Config *config;
+    int max_time;
+} PolicyRunBatch;
 
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q, temp_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-    init_queue(&temp_q);
-
-    int *waiting_q = (int *)malloc(sizeof(int) * count);
-    for (int i = 0; i < count; i++) {
-        waiting_q[i] = -1;
-    }
-
-    int time = 0;
-    int completed = 0;
-    int idle_time = 0;
-    int pick = -1;
-    int preempted = -1;
-
-    while (completed < count) {
-        // 도착 프로세스 처리 및 I/O 완료 처리
-        for (int i = 0; i < count; i++) {
-
-            // 도착 프로세스 처리 및 선점 여부 처리
-            if (processes[i].arrival_time == time) {
-                // 새로 도착한 프로세스로 선점 검사
-                if (!is_empty(&running_q)) {
-                    int current = peek(&running_q);
-                    if (processes[i].cpu_burst - processes[i].progress <
-                        processes[current].cpu_burst -
-                            processes[current].progress) {
-                        // 선점 발생
-                        preempted = dequeue(&running_q);
-                        enqueue(&ready_q, preempted);
-                        enqueue(&running_q, i);
-                    } else {
-                        // ready queue에 추가
-                        enqueue(&ready_q, i);
-                    }
-                } else {
-                    // ready queue에 추가
-                    enqueue(&ready_q, i);
-                }
-            }
-
-            // I/O 완료 처리
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    // I/O 완료 후 선점 검사
-                    if (!is_empty(&running_q)) {
-                        int current = peek(&running_q);
-                        int remaining_current = processes[current].cpu_burst -
-                                                processes[current].progress;
-                        int remaining_i =
-                            processes[i].cpu_burst - processes[i].progress;
-
-                        if (remaining_i < remaining_current) {
-                            // 선점 발생
-                            preempted = dequeue(&running_q);
-                            enqueue(&ready_q, preempted);
-                            enqueue(&running_q, i);
-                        } else {
-                            // ready queue에 추가
-                            enqueue(&ready_q, i);
-                        }
-                    } else {
-                        // running queue가 비어있으면 바로 실행
-                        enqueue(&ready_q, i);
-                    }
-                    waiting_q[i] = -1;
-                }
-            }
-        }
-        if (!is_empty(&ready_q)) {
-            sort_queue(&ready_q, processes, SORT_BY_REMAINING_TIME);
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            pick = dequeue(&ready_q);
-            enqueue(&running_q, pick);
-        }
-
-        // 프로세스 실행 및 상태 변경
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            pick = peek(&running_q);
-            add_gantt_entry(&gantt, time, time + 1, pick, "RUN");
-
-            processes[pick].progress++;
-            processes[pick].remaining_time =
-                processes[pick].cpu_burst - processes[pick].progress;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&processes[pick],
-                                   processes[pick].progress)) {
-                int waiting = dequeue(&running_q);
-                int io_burst = get_io_burst_at_progress(
-                    &processes[waiting], processes[waiting].progress);
-                waiting_q[waiting] = io_burst + 1;
-
-            } else if (processes[pick].progress == processes[pick].cpu_burst) {
-                // 프로세스 완료
-                int finished = dequeue(&running_q);
-                processes[finished].comp_time = time + 1;
-                processes[finished].turnaround_time =
-                    processes[finished].comp_time -
-                    processes[finished].arrival_time;
-                processes[finished].waiting_time =
-                    processes[finished].waiting_time_counter;
-
-                completed++;
-            }
-        }
-
-        // 대기 큐 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    processes[pid].waiting_time_counter++;
-                }
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력 (간소화)
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue: ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(rem:%d) ", pid,
-        //                processes[pid].cpu_burst - processes[pid].progress);
-        //     }
-        //     printf("\n");
-        // }
-
-        time++;
-    }
+static void run_policy_task(void *arg, int index) {
+    PolicyRunBatch *batch = (PolicyRunBatch *)arg;
+    PolicyRun *run = &batch->runs[index];
 
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-
-    // printf("\nPreemptive SJF scheduling completed at time %d\n", time);
-    // printf("Total idle time: %d\n", idle_time);
-
-    // 평균 통계 계산 및 출력
-    // double avg_waiting = 0, avg_turnaround = 0;
-    // for (int i = 0; i < count; i++) {
-    //     avg_waiting += processes[i].waiting_time;
-    //     avg_turnaround += processes[i].turnaround_time;
-    // }
-    // avg_waiting /= count;
-    // avg_turnaround /= count;
-
-    // printf("Average Waiting Time: %.2f\n", avg_waiting);
-    // printf("Average Turnaround Time: %.2f\n", avg_turnaround);
-
-    display_scheduling_results(processes, count, &gantt, time, idle_time,
-                               "Preemptive SJF Multi-I/O");
-
-    free(gantt.entries);
-    free(waiting_q);
-
-    return metrics;
+    simulate_policy(run->policy, batch->workload, batch->count, batch->config,
+                    batch->max_time, &run->state, &run->result);
 }
 
-Metrics *run_priority_np(Process *processes, int count) {
-    printf("\n");
-    print_thin_emphasized_header(
-        "Non-Preemptive Priority Scheduling with Multi-I/O", 150);
-    printf("\n");
-
-    Metrics *metrics;
-    metrics = malloc(sizeof(Metrics));
-
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q, temp_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-    init_queue(&temp_q);
-
-    int *waiting_q = (int *)malloc(sizeof(int) * count);
-    for (int i = 0; i < count; i++) {
-        waiting_q[i] = -1;
-    }
-
-    int time = 0;
-    int completed = 0;
-    int idle_time = 0;
-    int pick = -1;
-
-    while (completed < count) {
-        // 도착 프로세스 처리 및 I/O 완료 처리
-        for (int i = 0; i < count; i++) {
-            // 도착 프로세스 처리
-            if (processes[i].arrival_time == time) {
-                enqueue(&ready_q, i);
-            }
-
-            // I/O 완료 처리
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    enqueue(&ready_q, i);
-                    waiting_q[i] = -1;
-                }
-            }
-        }
-
-        // Ready queue를 우선순위 기준으로 정렬
-        if (!is_empty(&ready_q)) {
-            sort_queue(&ready_q, processes, SORT_BY_PRIORITY);
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            pick = dequeue(&ready_q);
-            enqueue(&running_q, pick);
-        }
-
-        // 프로세스 실행 및 상태 변경
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            add_gantt_entry(&gantt, time, time + 1, pick, "RUN");
-            processes[pick].progress++;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&processes[pick],
-                                   processes[pick].progress)) {
-                int waiting = dequeue(&running_q);
-                int io_burst = get_io_burst_at_progress(
-                    &processes[waiting], processes[waiting].progress);
-                waiting_q[waiting] = io_burst + 1;
-
-            } else if (processes[pick].progress == processes[pick].cpu_burst) {
-                // 프로세스 완료
-                int finished = dequeue(&running_q);
-                processes[finished].comp_time = time + 1;
-                processes[finished].turnaround_time =
-                    processes[finished].comp_time -
-                    processes[finished].arrival_time;
-                processes[finished].waiting_time =
-                    processes[finished].waiting_time_counter;
-
-                completed++;
-            }
-        }
-
-        // 대기 큐 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    processes[pid].waiting_time_counter++;
-                }
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력 (간소화)
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue (Priority order): ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(pri:%d) ", pid, processes[pid].priority);
-        //     }
-        //     printf("\n");
-        // }
-
-        time++;
+// 하나의 워크로드를 공유하면서 runs[i].policy마다 병렬로 시뮬레이션
+// (결과를 나중에 출력하므로 실행마다 state를 따로 둔다)
+// 출력은 하지 않으며, 끝난 뒤 free_policy_run으로 정리한다
+void simulate_policies(PolicyRun *runs, int run_count,
+                       const Process *workload, int count, Config *config,
+                       int max_time) {
+    for (int i = 0; i < run_count; i++) {
+        init_sched_state(&runs[i].state, count);
     }
 
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-
-    // printf("\nNon-Preemptive Priority scheduling completed at time %d\n",
-    // time); printf("Total idle time: %d\n", idle_time);
-
-    // 평균 통계 계산 및 출력
-    // double avg_waiting = 0, avg_turnaround = 0;
-    // for (int i = 0; i < count; i++) {
-    //     avg_waiting += processes[i].waiting_time;
-    //     avg_turnaround += processes[i].turnaround_time;
-    // }
-    // avg_waiting /= count;
-    // avg_turnaround /= count;
-
-    // printf("Average Waiting Time: %.2f\n", avg_waiting);
-    // printf("Average Turnaround Time: %.2f\n", avg_turnaround);
-
-    display_scheduling_results(processes, count, &gantt, time, idle_time,
-                               "Non-Preemptive Priority Multi-I/O");
-
-    free(gantt.entries);
-    free(waiting_q);
-
-    return metrics;
+    PolicyRunBatch batch = {runs, workload, count, config, max_time};
+    parallel_for(run_count, config ? config->worker_threads : 0,
+                 run_policy_task, &batch);
 }
 
-Metrics *run_priority_p(Process *processes, int count) {
-    printf("\n");
-    print_thin_emphasized_header(
-        "Preemptive Priority Scheduling with Multi-I/O", 150);
-    printf("\n");
-
-    Metrics *metrics;
-    metrics = malloc(sizeof(Metrics));
-
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q, temp_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-    init_queue(&temp_q);
-
-    int *waiting_q = (int *)malloc(sizeof(int) * count);
-    for (int i = 0; i < count; i++) {
-        waiting_q[i] = -1;
-    }
-
-    int time = 0;
-    int completed = 0;
-    int idle_time = 0;
-    int pick = -1;
-    int preempted = -1;
-
-    while (completed < count) {
-        // 도착 프로세스 처리 및 I/O 완료 처리
-        for (int i = 0; i < count; i++) {
-            // 도착 프로세스 처리 및 선점 여부 처리
-            if (processes[i].arrival_time == time) {
-                // 새로 도착한 프로세스로 선점 검사
-                if (!is_empty(&running_q)) {
-                    int current = peek(&running_q);
-                    if (processes[i].priority < processes[current].priority) {
-                        // 선점 발생
-                        preempted = dequeue(&running_q);
-                        enqueue(&ready_q, preempted);
-                        enqueue(&running_q, i);
-                    } else {
-                        // ready queue에 추가
-                        enqueue(&ready_q, i);
-                    }
-                } else {
-                    // ready queue에 추가
-                    enqueue(&ready_q, i);
-                }
-            }
-
-            // I/O 완료 처리
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    // I/O 완료 후 선점 검사
-                    if (!is_empty(&running_q)) {
-                        int current = peek(&running_q);
-                        if (processes[i].priority <
-                            processes[current].priority) {
-                            // 선점 발생
-                            preempted = dequeue(&running_q);
-                            enqueue(&ready_q, preempted);
-                            enqueue(&running_q, i);
-                        } else {
-                            // ready queue에 추가
-                            enqueue(&ready_q, i);
-                        }
-                    } else {
-                        // running queue가 비어있으면 바로 실행
-                        enqueue(&ready_q, i);
-                    }
-                    waiting_q[i] = -1;
-                }
-            }
-        }
-
-        // Ready queue를 우선순위 기준으로 정렬
-        if (!is_empty(&ready_q)) {
-            sort_queue(&ready_q, processes, SORT_BY_PRIORITY);
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            pick = dequeue(&ready_q);
-            enqueue(&running_q, pick);
-        }
-
-        // 프로세스 실행 및 상태 변경
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            pick = peek(&running_q);
-            add_gantt_entry(&gantt, time, time + 1, pick, "RUN");
-            processes[pick].progress++;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&processes[pick],
-                                   processes[pick].progress)) {
-                int waiting = dequeue(&running_q);
-                int io_burst = get_io_burst_at_progress(
-                    &processes[waiting], processes[waiting].progress);
-                waiting_q[waiting] = io_burst + 1;
-
-            } else if (processes[pick].progress == processes[pick].cpu_burst) {
-                // 프로세스 완료
-                int finished = dequeue(&running_q);
-                processes[finished].comp_time = time + 1;
-                processes[finished].turnaround_time =
-                    processes[finished].comp_time -
-                    processes[finished].arrival_time;
-                processes[finished].waiting_time =
-                    processes[finished].waiting_time_counter;
-
-                completed++;
-            }
-        }
-
-        // 대기 큐 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    processes[pid].waiting_time_counter++;
-                }
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력 (간소화)
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue (Priority order): ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(pri:%d) ", pid, processes[pid].priority);
-        //     }
-        //     printf("\n");
-        // }
+void free_policy_run(PolicyRun *run) {
+    free_simulation_result(&run->result);
+    free_sched_state(&run->state);
+}
 
-        time++;
+// 비교표/배치 출력에 쓰는 알고리즘 이름
+const char *policy_name(SchedulingPolicy policy) {
+    switch (policy) {
+    case POLICY_FCFS:
+        return "FCFS";
+    case POLICY_SJF_NP:
+        return "Non-Preemptive SJF";
+    case POLICY_SJF_P:
+        return "Preemptive SJF";
+    case POLICY_PRIORITY_NP:
+        return "Non-Preemptive Priority";
+    case POLICY_PRIORITY_P:
+        return "Preemptive Priority";
+    case POLICY_RR:
+        return "Round Robin";
+    case POLICY_PRIORITY_AGING:
+        return "Priority with Aging";
+    case POLICY_RMS:
+        return "RMS";
+    case POLICY_EDF:
+        return "EDF";
     }
-
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-
-    // printf("\nPreemptive Priority scheduling completed at time %d\n", time);
-    // printf("Total idle time: %d\n", idle_time);
-
-    // 평균 통계 계산 및 출력
-    // double avg_waiting = 0, avg_turnaround = 0;
-    // for (int i = 0; i < count; i++) {
-    //     avg_waiting += processes[i].waiting_time;
-    //     avg_turnaround += processes[i].turnaround_time;
-    // }
-    // avg_waiting /= count;
-    // avg_turnaround /= count;
-
-    // printf("Average Waiting Time: %.2f\n", avg_waiting);
-    // printf("Average Turnaround Time: %.2f\n", avg_turnaround);
-
-    display_scheduling_results(processes, count, &gantt, time, idle_time,
-                               "Preemptive Priority Multi-I/O");
-
-    free(gantt.entries);
-    free(waiting_q);
-
-    return metrics;
+    return "";
 }
 
-Metrics *run_rr(Process *processes, int count, Config *config) {
-    printf("\n");
-    print_thin_emphasized_header("Round Robin Scheduling with Multi-I/O", 150);
-    printf("\n");
-
-    Metrics *metrics;
-    metrics = malloc(sizeof(Metrics));
-
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
 
-    int *waiting_q = (int *)malloc(sizeof(int) * count);
-    int *time_quantum = (int *)malloc(sizeof(int) * count);
+// 완료된 프로세스 반환 시간의 95번째 백분위 (nearest-rank, 기록이 없으면 -1)
+static float turnaround_p95(const SimulationResult *result) {
+    int count = result->completed;
+    if (result->outcomes == NULL || count == 0)
+        return -1.0;
 
-    for (int i = 0; i < count; i++) {
-        waiting_q[i] = -1;
-        time_quantum[i] = 0;
+    int *turnaround = malloc(sizeof(int) * count);
+    if (turnaround == NULL) {
+        perror("metrics");
+        exit(1);
     }
-
-    int time = 0;
-    int completed = 0;
-    int idle_time = 0;
-    int pick = -1;
-    int quantum = config->time_quantum;
-
-    printf("** Time Quantum: %d **\n\n", quantum);
-
-    while (completed < count) {
-        // 타임 퀀텀 만료 처리 (새로운 프로세스 도착 전에 먼저 처리)
-        if (!is_empty(&running_q) &&
-            time_quantum[peek(&running_q)] == quantum) {
-            int rotated = dequeue(&running_q);
-            enqueue(&ready_q, rotated);
-            time_quantum[rotated] = 0;
-        }
-
-        // 도착 프로세스 처리 및 I/O 완료 처리
-        for (int i = 0; i < count; i++) {
-            // 도착 프로세스 처리
-            if (processes[i].arrival_time == time) {
-                enqueue(&ready_q, i);
-            }
-
-            // I/O 완료 처리
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    enqueue(&ready_q, i);
-                    waiting_q[i] = -1;
-                    time_quantum[i] = 0; // 타임 퀀텀 리셋
-                }
-            }
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            pick = dequeue(&ready_q);
-            enqueue(&running_q, pick);
-        }
-
-        // 프로세스 실행 및 상태 변경
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            pick = peek(&running_q);
-            add_gantt_entry(&gantt, time, time + 1, pick, "RUN");
-
-            processes[pick].progress++;
-            time_quantum[pick]++;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&processes[pick],
-                                   processes[pick].progress)) {
-                int waiting = dequeue(&running_q);
-                int io_burst = get_io_burst_at_progress(
-                    &processes[waiting], processes[waiting].progress);
-                waiting_q[waiting] = io_burst + 1;
-                time_quantum[waiting] = 0; // 타임 퀀텀 리셋
-
-            } else if (processes[pick].progress == processes[pick].cpu_burst) {
-                // 프로세스 완료
-                int finished = dequeue(&running_q);
-                processes[finished].comp_time = time + 1;
-                processes[finished].turnaround_time =
-                    processes[finished].comp_time -
-                    processes[finished].arrival_time;
-                processes[finished].waiting_time =
-                    processes[finished].waiting_time_counter;
-
-                completed++;
-                time_quantum[finished] = 0;
-            }
-        }
-
-        // 대기 큐 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    processes[pid].waiting_time_counter++;
-                }
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력 (간소화)
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue: ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(prog:%d/%d) ", pid, processes[pid].progress,
-        //                processes[pid].cpu_burst);
-        //     }
-        //     printf("\n");
-        // }
-
-        time++;
+    for (int i = 0; i < count; i++) {
+        turnaround[i] = result->outcomes[i].turnaround_time;
     }
+    qsort(turnaround, count, sizeof(int), compare_int);
 
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-
-    // printf("\nRound Robin scheduling completed at time %d\n", time);
-    // printf("Total idle time: %d\n", idle_time);
-
-    // // Round Robin 성능 분석
-    // printf("\nRound Robin Performance Analysis:\n");
-    // printf("Time Quantum: %d\n", quantum);
-
-    // // 평균 통계 계산 및 출력
-    // double avg_waiting = 0, avg_turnaround = 0;
-
-    // for (int i = 0; i < count; i++) {
-    //     avg_waiting += processes[i].waiting_time;
-    //     avg_turnaround += processes[i].turnaround_time;
-    // }
-    // avg_waiting /= count;
-    // avg_turnaround /= count;
-
-    // printf("Average Waiting Time: %.2f\n", avg_waiting);
-    // printf("Average Turnaround Time: %.2f\n", avg_turnaround);
-
-    display_scheduling_results(processes, count, &gantt, time, idle_time,
-                               "Round Robin Multi-I/O");
-
-    free(gantt.entries);
-    free(waiting_q);
-    free(time_quantum);
-
-    return metrics;
+    int rank = (int)ceil(count * 0.95);
+    float p95 = turnaround[rank > 0 ? rank - 1 : 0];
+    free(turnaround);
+    return p95;
 }
 
-Metrics *run_priority_with_aging(Process *processes, int count) {
-    printf("\n");
-    print_thin_emphasized_header(
-        "Priority Scheduling with Aging(Preemptive) and Multi-I/O", 150);
-    printf("\n");
-
-    Metrics *metrics;
-    metrics = malloc(sizeof(Metrics));
-
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q, temp_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-    init_queue(&temp_q);
-
-    Process *p_copy = (Process *)malloc(sizeof(Process) * count);
-    // 기존 프로세스 정보 유지를 위한 복제
-    memcpy(p_copy, processes, sizeof(Process) * count);
-
-    int *waiting_q = (int *)malloc(sizeof(int) * count);
-    int *age = (int *)malloc(sizeof(int) * count);
-
-    for (int i = 0; i < count; i++) {
-        waiting_q[i] = -1;
-        age[i] = 0;
+// 끝난 시뮬레이션 결과로 비교용 지표 계산
+// (report_simulation이 결과를 해제하기 전에 호출해야 한다)
+void collect_algorithm_metrics(AlgorithmMetrics *m, SchedulingPolicy policy,
+                               SimulationResult *result) {
+    strcpy(m->name, policy_name(policy));
+    m->cores = result->core_count;
+    m->steals = result->steals;
+    m->migrations = result->migrations;
+    m->switches = result->switches;
+    m->overhead_time = result->overhead_time;
+    m->p95_turnaround = -1.0;
+    // 코어가 여럿이면 모든 코어의 시간을 합친 용량 대비 실행 시간
+    long capacity = (long)result->total_time * result->core_count;
+    m->cpu_utilization =
+        ((float)(capacity - result->idle_time) / capacity) * 100.0;
+    m->total_time = result->total_time;
+
+    if (policy != POLICY_RMS && policy != POLICY_EDF) {
+        int count = result->completed;
+
+        m->avg_wait_time =
+            count > 0 ? (float)result->total_waiting / count : 0.0;
+        m->avg_turnaround_time =
+            count > 0 ? (float)result->total_turnaround / count : 0.0;
+        m->throughput = ((float)count / result->total_time) *
+                        100.0; // 단위 시간당 처리하는 프로세스 양
+        m->missed_deadlines = 0;
+        m->p95_turnaround = turnaround_p95(result);
+        return;
     }
 
-    const int AGING_THRESHOLD = 3;
-
-    int time = 0;
-    int completed = 0;
-    int idle_time = 0;
-    int pick = -1;
-    int preempted = -1;
+    // 인스턴스 기록이 없어도 되도록 엔진이 센 합계를 사용
+    int instance_count = result->instance_count;
+    int completed_processes = result->completed;
+
+    m->avg_wait_time = completed_processes > 0
+                           ? (float)result->total_waiting / instance_count
+                           : 0.0;
+    m->avg_turnaround_time = -1.0; // EDF/RMS는 turnaround time을 계산하지 않음
+    m->throughput =
+        ((float)completed_processes / result->total_time) * 100.0;
+    m->missed_deadlines = result->miss_count;
+}
 
+static void print_aging_log(SimulationResult *result) {
     printf("\n** Aging Information (Threshold: %d) **\n", AGING_THRESHOLD);
     printf("+------+-------------+---------------+-----------------+\n");
     printf("| Time | Process ID  | Current Age   | Priority Change |\n");
     printf("+------+-------------+---------------+-----------------+\n");
 
-    while (completed < count) {
-        // AGING 대상자 찾기 및 나이 증가
-        int aging_candidates[100];
-        int aging_count = 0;
-
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    age[pid]++;
-                    if (age[pid] >= AGING_THRESHOLD &&
-                        processes[pid].priority > 1) {
-                        aging_candidates[aging_count++] = pid;
-                    }
-                }
-            }
-        }
-
-        // 나이 증가 후 우선순위 변경
-        for (int i = 0; i < aging_count; i++) {
-            int pid = aging_candidates[i];
-            int old_priority = processes[pid].priority;
-            processes[pid].priority--;
-
-            printf("| %-4d | P%-10d | %-13d | %7d → %-6d|\n", time, pid,
-                   age[pid], old_priority, processes[pid].priority);
-
-            age[pid] = 0;
-        }
-
-        // 우선순위 변경 후 ready queue 재정렬 (aging이 발생한 경우에만)
-        if (aging_count > 0 && !is_empty(&ready_q)) {
-            sort_queue(&ready_q, processes, SORT_BY_PRIORITY);
-        }
-
-        // 선점 처리 (Aging 후)
-        if (!is_empty(&running_q) && !is_empty(&ready_q)) {
-            int running_pid = peek(&running_q);
-            int top_ready_pid = peek(&ready_q);
-
-            if (processes[top_ready_pid].priority <
-                processes[running_pid].priority) {
-                int preempted = dequeue(&running_q);
-                enqueue(&ready_q, preempted);
-
-                int promoted = dequeue(&ready_q);
-                enqueue(&running_q, promoted);
-                age[promoted] = 0;
-
-                printf(
-                    "| %-4d | P%-10d |     (Aging preemption occurred)   |\n",
-                    time, promoted);
-            }
-        }
-
-        // 도착 프로세스 처리 (I/O 완료 처리보다 먼저)
-        for (int i = 0; i < count; i++) {
-            if (processes[i].arrival_time == time) {
-                // 새로 도착한 프로세스로 선점 검사
-                if (!is_empty(&running_q)) {
-                    int current = peek(&running_q);
-                    if (processes[i].priority < processes[current].priority) {
-                        // 선점 발생
-                        preempted = dequeue(&running_q);
-                        enqueue(&ready_q, preempted);
-                        enqueue(&running_q, i);
-                        age[i] = 0;
-                    } else {
-                        // ready queue에 추가
-                        enqueue(&ready_q, i);
-                    }
-                } else {
-                    // running queue가 비어있어도 ready queue에 추가
-                    enqueue(&ready_q, i);
-                }
-            }
-        }
-
-        // I/O 완료 처리
-        for (int i = 0; i < count; i++) {
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    // I/O 완료 후 선점 검사
-                    if (!is_empty(&running_q)) {
-                        int current = peek(&running_q);
-                        if (processes[i].priority <
-                            processes[current].priority) {
-                            // 선점 발생
-                            preempted = dequeue(&running_q);
-                            enqueue(&ready_q, preempted);
-                            enqueue(&running_q, i);
-                            age[i] = 0;
-                        } else {
-                            // ready queue에 추가
-                            enqueue(&ready_q, i);
-                        }
-                    } else {
-                        // running queue가 비어있어도 ready queue에 추가
-                        enqueue(&ready_q, i);
-                    }
-                    waiting_q[i] = -1;
-                }
-            }
-        }
-
-        // Ready queue를 우선순위 기준으로 정렬 (CPU 할당 직전에 일괄 정렬)
-        if (!is_empty(&ready_q)) {
-            sort_queue(&ready_q, processes, SORT_BY_PRIORITY);
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            pick = dequeue(&ready_q);
-            enqueue(&running_q, pick);
-            age[pick] = 0;
-        }
-
-        // 프로세스 실행 및 상태 변경
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
+    for (int i = 0; i < result->aging_count; i++) {
+        AgingLogEntry *entry = &result->aging_log[i];
+        if (entry->preemption) {
+            printf(
+                "| %-4d | P%-10d |     (Aging preemption occurred)   |\n",
+                entry->time, entry->pid);
         } else {
-            pick = peek(&running_q);
-            add_gantt_entry(&gantt, time, time + 1, pick, "RUN");
-            processes[pick].progress++;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&processes[pick],
-                                   processes[pick].progress)) {
-                int waiting = dequeue(&running_q);
-                int io_burst = get_io_burst_at_progress(
-                    &processes[waiting], processes[waiting].progress);
-                waiting_q[waiting] = io_burst + 1;
-
-            } else if (processes[pick].progress == processes[pick].cpu_burst) {
-                // 프로세스 완료
-                int finished = dequeue(&running_q);
-                processes[finished].comp_time = time + 1;
-                processes[finished].turnaround_time =
-                    processes[finished].comp_time -
-                    processes[finished].arrival_time;
-                processes[finished].waiting_time =
-                    processes[finished].waiting_time_counter;
-
-                completed++;
-            }
+            printf("| %-4d | P%-10d | %-13d | %7d → %-6d|\n", entry->time,
+                   entry->pid, entry->age, entry->old_priority,
+                   entry->new_priority);
         }
-
-        // 대기 큐 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                if (pid >= 0 && pid < count) {
-                    processes[pid].waiting_time_counter++;
-                }
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력 (간소화)
-        // if (!is_empty(&ready_q)) { // 5시간마다 출력
-        //     printf("Time %d Ready Queue: ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(pri:%d)", pid, processes[pid].priority);
-        //     }
-        //     printf("\n");
-        // }
-
-        time++;
     }
 
     printf("+------+-------------+---------------+-----------------+\n\n");
-
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-
-    // Aging 효과 분석
-    // printf("** Aging Analysis **\n");
-    // printf("Aging Threshold: %d time units\n", AGING_THRESHOLD);
-    // for (int i = 0; i < count; i++) {
-    //     printf("P%d: Initial Priority %d → Final Priority %d (Change: %d)\n",
-    //     i,
-    //            p_copy[i].priority, processes[i].priority,
-    //            p_copy[i].priority - processes[i].priority);
-    // }
-
-    // 원래 우선순위로 복원
-    for (int i = 0; i < count; i++) {
-        processes[i].priority = p_copy[i].priority;
-    }
-
-    display_scheduling_results(processes, count, &gantt, time, idle_time,
-                               "Priority with Aging Multi-I/O");
-
-    free(gantt.entries);
-    free(waiting_q);
-    free(age);
-    free(p_copy);
-
-    return metrics;
 }
 
-Metrics *run_rms(Process *processes, int count, Config *config, int max_time) {
-    printf("\n");
-    print_thin_emphasized_header("Rate Monotonic Scheduling with Multi-I/O",
-                                 150);
-    printf("\n");
-
-    Metrics *metrics = malloc(sizeof(Metrics));
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
+static void print_real_time_tables(SchedulingPolicy policy,
+                                   Process *processes, int count) {
+    print_utilization_analysis(processes, count,
+                               policy == POLICY_RMS ? "RMS" : "EDF");
 
-    Queue ready_q, running_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-
-    // 원본 프로세스 정보 저장
-    Process *original_processes = malloc(sizeof(Process) * count);
-    memcpy(original_processes, processes, sizeof(Process) * count);
-
-    // 동적으로 확장 가능한 프로세스 배열
-    int max_processes = count * 20; // 충분한 공간 할당
-    Process *all_processes = malloc(sizeof(Process) * max_processes);
-    int total_process_count = 0;
-
-    // 초기 프로세스들은 실제 arrival_time에 도착하므로 여기서 추가하지 않음
-    // next_arrival을 초기 arrival_time으로 설정
-    int *next_arrival = malloc(sizeof(int) * count);
-    for (int i = 0; i < count; i++) {
-        next_arrival[i] = original_processes[i].arrival_time;
-    }
-
-    DeadlineMissInfo *deadline_miss_info =
-        malloc(sizeof(DeadlineMissInfo) * count * 10);
-    config->deadline_miss_info_count = 0;
-
-    int *waiting_q = malloc(sizeof(int) * max_processes);
-    for (int i = 0; i < max_processes; i++) {
-        waiting_q[i] = -1;
+    if (policy == POLICY_RMS) {
+        printf("\n** Process Period Information (Lower Period = Higher "
+               "Priority) **\n");
+    } else {
+        printf("\n** Process Deadline Information **\n");
     }
-
-    int time = 0;
-    int idle_time = 0;
-
-    print_utilization_analysis(original_processes, count, "RMS");
-
-    printf("\n** Process Period Information (Lower Period = Higher Priority) "
-           "**\n");
     printf("+------+-------------+------------+------------+------------+------"
            "------+-----+\n");
     printf("| PID  |   Arrival   |   Period   | Deadline 1 | Deadline 2 | "
@@ -1248,496 +203,242 @@ Metrics *run_rms(Process *processes, int count, Config *config, int max_time) {
            "------+-----+\n");
     for (int i = 0; i < count; i++) {
         printf("| P%-3d | %-11d | %-10d | %-10d | %-10d | %-10d | ... |\n", i,
-               original_processes[i].arrival_time, original_processes[i].period,
-               original_processes[i].deadline,
-               original_processes[i].deadline + original_processes[i].period,
-               original_processes[i].deadline +
-                   2 * original_processes[i].period);
+               processes[i].arrival_time, processes[i].period,
+               processes[i].deadline,
+               processes[i].deadline + processes[i].period,
+               processes[i].deadline + 2 * processes[i].period);
     }
     printf("+------+-------------+------------+------------+------------+------"
            "------+-----+\n\n");
+}
 
+static void print_deadline_misses(SimulationResult *result) {
     printf("** Deadline Misses Log **\n");
     printf("+------+-------------+------------------+-----------------+\n");
     printf("| Time | Process ID  | Absolute Deadline| Completion Time |\n");
     printf("+------+-------------+------------------+-----------------+\n");
 
-    int has_missed = 0;
-
-    while (time < max_time) {
-        // 새로운 프로세스 인스턴스 생성 (초기 도착 + 주기적 도착)
-        for (int i = 0; i < count; i++) {
-            if (next_arrival[i] == time) {
-                // 새로운 프로세스 인스턴스 생성
-                Process new_process;
-                memcpy(&new_process, &original_processes[i], sizeof(Process));
-
-                // 새로운 인스턴스의 속성 설정 (PID는 원본과 동일하게 유지)
-                new_process.pid = i; // 원본 프로세스와 동일한 PID 유지
-                new_process.arrival_time = time;
-
-                // 첫 번째 도착인지 주기적 도착인지 확인하여 deadline 설정
-                if (time == original_processes[i].arrival_time) {
-                    // 첫 번째 도착 - 원본 deadline 사용
-                    new_process.deadline = original_processes[i].deadline;
-                } else {
-                    // 주기적 도착 - deadline 계산
-                    int period_count =
-                        (time - original_processes[i].arrival_time) /
-                        original_processes[i].period;
-                    new_process.deadline =
-                        original_processes[i].deadline +
-                        period_count * original_processes[i].period;
-                }
-
-                new_process.progress = 0;
-                new_process.waiting_time_counter = 0;
-                new_process.comp_time = 0;
-                new_process.waiting_time = 0;
-                new_process.turnaround_time = 0;
-                new_process.missed_deadline = 0;
-
-                // all_processes 배열에 추가
-                all_processes[total_process_count] = new_process;
-
-                // 다음 도착 시간 업데이트
-                next_arrival[i] += original_processes[i].period;
-
-                // 스케줄링 결정 (period 기준)
-                if (!is_empty(&running_q)) {
-                    int current_running = peek(&running_q);
-                    if (all_processes[total_process_count].period <
-                        all_processes[current_running].period) {
-                        int preempted = dequeue(&running_q);
-                        enqueue(&ready_q, preempted);
-                        enqueue(&running_q, total_process_count);
-                    } else {
-                        // 단순 enqueue (나중에 일괄 정렬)
-                        enqueue(&ready_q, total_process_count);
-                    }
-                } else {
-                    // 단순 enqueue (나중에 일괄 정렬)
-                    enqueue(&ready_q, total_process_count);
-                }
-
-                total_process_count++;
-            }
-        }
-
-        // I/O 완료 처리
-        for (int i = 0; i < total_process_count; i++) {
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    // I/O 완료 후 스케줄링 결정
-                    if (!is_empty(&running_q)) {
-                        int current_running = peek(&running_q);
-                        if (all_processes[i].period <
-                            all_processes[current_running].period) {
-                            int preempted = dequeue(&running_q);
-                            enqueue(&ready_q, preempted);
-                            enqueue(&running_q, i);
-                        } else {
-                            enqueue(&ready_q, i);
-                        }
-                    } else {
-                        enqueue(&ready_q, i);
-                    }
-                    waiting_q[i] = -1;
-                }
-            }
-        }
-
-        // Ready queue를 period 기준으로 정렬 (CPU 할당 직전에 일괄 정렬)
-        if (!is_empty(&ready_q)) {
-            sort_queue(&ready_q, all_processes, SORT_BY_PERIOD);
-        }
-
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            int next_process =
-                dequeue(&ready_q); // 이미 정렬되어 있으므로 첫 번째가 최단 주기
-            enqueue(&running_q, next_process);
-        }
-
-        // 프로세스 실행
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            int current_running = peek(&running_q);
-            // Gantt 차트에는 실제 PID를 사용
-            add_gantt_entry(&gantt, time, time + 1,
-                            all_processes[current_running].pid, "RUN");
-
-            all_processes[current_running].progress++;
-
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&all_processes[current_running],
-                                   all_processes[current_running].progress)) {
-                int io_process = current_running;
-                int io_burst = get_io_burst_at_progress(
-                    &all_processes[io_process],
-                    all_processes[io_process].progress);
-                waiting_q[io_process] = io_burst + 1;
-                dequeue(&running_q);
-            }
-            // 프로세스 완료 처리
-            else if (all_processes[current_running].progress ==
-                     all_processes[current_running].cpu_burst) {
-                int finished = current_running;
-                all_processes[finished].comp_time = time + 1;
-                all_processes[finished].turnaround_time =
-                    all_processes[finished].comp_time -
-                    all_processes[finished].arrival_time;
-                all_processes[finished].waiting_time =
-                    all_processes[finished].waiting_time_counter;
-
-                // 데드라인 미스 체크
-                if (all_processes[finished].comp_time >
-                    all_processes[finished].deadline) {
-                    deadline_miss_info[config->deadline_miss_info_count].pid =
-                        all_processes[finished].pid; // 실제 PID 사용
-                    deadline_miss_info[config->deadline_miss_info_count]
-                        .absolute_deadline = all_processes[finished].deadline;
-                    deadline_miss_info[config->deadline_miss_info_count]
-                        .completion_time = all_processes[finished].comp_time;
-
-                    all_processes[finished].missed_deadline = 1;
-                    config->deadline_miss_info_count++;
-                    has_missed = 1;
-
-                    printf("| %4d | P%-10d | %-16d | %-15d |\n", time + 1,
-                           all_processes[finished].pid,
-                           all_processes[finished].deadline,
-                           all_processes[finished].comp_time);
-                }
-
-                dequeue(&running_q);
-            }
-        }
-
-        // Ready queue의 프로세스들만 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                all_processes[pid].waiting_time_counter++;
-            }
-        }
-
-        // 디버깅용 ready queue 상태 출력
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue (Period order): ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(pr:%d) ", all_processes[pid].pid,
-        //                all_processes[pid].period);
-        //     }
-        // }
-
-        time++;
+    for (int i = 0; i < result->miss_count; i++) {
+        printf("| %4d | P%-10d | %-16d | %-15d |\n",
+               result->misses[i].completion_time, result->misses[i].pid,
+               result->misses[i].absolute_deadline,
+               result->misses[i].completion_time);
     }
-    if (!has_missed) {
+    if (result->miss_count == 0) {
         printf("|                There is no deadline miss                |\n");
     }
     printf("+------+-------------+------------------+-----------------+\n\n");
-
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-    metrics->for_edf_rms_processes = all_processes;
-    metrics->for_edf_rms_counter = total_process_count;
-
-    printf("** Total Deadline Misses: %d **\n",
-           config->deadline_miss_info_count);
-
-    // 모든 프로세스 인스턴스를 포함하여 결과 출력
-    display_scheduling_results(all_processes, total_process_count, &gantt, time,
-                               idle_time,
-                               "Rate Monotonic Scheduling Multi-I/O");
-
-    free(gantt.entries);
-    free(original_processes);
-    free(all_processes);
-    free(next_arrival);
-    free(deadline_miss_info);
-    free(waiting_q);
-
-    return metrics;
 }
 
-Metrics *run_edf(Process *processes, int count, Config *config, int max_time) {
-    printf("\n");
-    print_thin_emphasized_header(
-        "Earliest Deadline First Scheduling with Multi-I/O", 150);
-    printf("\n");
-
-    Metrics *metrics = malloc(sizeof(Metrics));
-    reset_processes(processes, count);
-
-    GanttChart gantt;
-    gantt.entries = malloc(sizeof(GanttEntry) * GanttEntrySize);
-    gantt.count = 0;
-    gantt.capacity = GanttEntrySize;
-
-    Queue ready_q, running_q;
-    init_queue(&ready_q);
-    init_queue(&running_q);
-
-    // 원본 프로세스 정보 저장
-    Process *original_processes = malloc(sizeof(Process) * count);
-    memcpy(original_processes, processes, sizeof(Process) * count);
-
-    // 동적으로 확장 가능한 프로세스 배열
-    int max_processes = count * 20; // 충분한 공간 할당
-    Process *all_processes = malloc(sizeof(Process) * max_processes);
-    int total_process_count = 0;
-
-    // 초기 프로세스들은 실제 arrival_time에 도착하므로 여기서 추가하지 않음
-    // next_arrival을 초기 arrival_time으로 설정
-    int *next_arrival = malloc(sizeof(int) * count);
-    for (int i = 0; i < count; i++) {
-        next_arrival[i] = original_processes[i].arrival_time;
+// 멀티코어 결과: 코어별 간트차트와 이용률을 단일 CPU 출력 사이에 넣음
+static const char *steal_policy_name(StealPolicy steal) {
+    switch (steal) {
+    case STEAL_NONE:
+        return "None";
+    case STEAL_HALF:
+        return "Half";
+    case STEAL_OLDEST:
+        return "Oldest";
+    case STEAL_SHORTEST:
+        return "Shortest Remaining";
     }
+    return "";
+}
 
-    DeadlineMissInfo *deadline_miss_info =
-        malloc(sizeof(DeadlineMissInfo) * count * 10);
-    config->deadline_miss_info_count = 0;
-
-    int *waiting_q = malloc(sizeof(int) * max_processes);
-    for (int i = 0; i < max_processes; i++) {
-        waiting_q[i] = -1;
+static void print_multicore_report(Process *processes, int count,
+                                   Config *config, SimulationResult *result,
+                                   const char *algorithm_name,
+                                   OutputLevel level) {
+    int cores = result->core_count;
+    printf("** %d Cores, %s Dispatch **\n", cores,
+           config->cpu.dispatch == DISPATCH_PARTITIONED ? "Partitioned"
+                                                        : "Global");
+
+    if (level == OUTPUT_FULL) {
+        display_core_gantt_charts(result->core_gantt, cores, algorithm_name);
+        display_process_table(processes, result->outcomes, count);
     }
-
-    int time = 0;
-    int idle_time = 0;
-
-    print_utilization_analysis(original_processes, count, "EDF");
-
-    printf("\n** Process Deadline Information **\n");
-    printf("+------+-------------+------------+------------+------------+------"
-           "------+-----+\n");
-    printf("| PID  |   Arrival   |   Period   | Deadline 1 | Deadline 2 | "
-           "Deadline 3 | ... |\n");
-    printf("+------+-------------+------------+------------+------------+------"
-           "------+-----+\n");
-    for (int i = 0; i < count; i++) {
-        printf("| P%-3d | %-11d | %-10d | %-10d | %-10d | %-10d | ... |\n", i,
-               original_processes[i].arrival_time, original_processes[i].period,
-               original_processes[i].deadline,
-               original_processes[i].deadline + original_processes[i].period,
-               original_processes[i].deadline +
-                   2 * original_processes[i].period);
+    display_performance_summary(processes, result->outcomes, count,
+                                result->total_time, result->idle_time, cores,
+                                result->switches, result->overhead_time);
+    display_core_utilization(result->core_busy, cores, result->total_time);
+    if (config->cpu.dispatch == DISPATCH_PARTITIONED &&
+        config->cpu.steal != STEAL_NONE) {
+        printf("- Work Stealing (%s): %d steals, %d migrations, "
+               "migration cost %d\n",
+               steal_policy_name(config->cpu.steal), result->steals,
+               result->migrations, config->cpu.migration_cost);
     }
-    printf("+------+-------------+------------+------------+------------+------"
-           "------+-----+\n\n");
-
-    printf("** Deadline Misses Log **\n");
-    printf("+------+-------------+------------------+-----------------+\n");
-    printf("| Time | Process ID  | Absolute Deadline| Completion Time |\n");
-    printf("+------+-------------+------------------+-----------------+\n");
-
-    int has_missed = 0;
-
-    while (time < max_time) {
-        // 새로운 프로세스 인스턴스 생성 (초기 도착 + 주기적 도착)
-        for (int i = 0; i < count; i++) {
-            if (next_arrival[i] == time) {
-                // 새로운 프로세스 인스턴스 생성
-                Process new_process;
-                memcpy(&new_process, &original_processes[i], sizeof(Process));
-
-                // 새로운 인스턴스의 속성 설정 (PID는 원본과 동일하게 유지)
-                new_process.pid = i; // 원본 프로세스와 동일한 PID 유지
-                new_process.arrival_time = time;
+    if (level == OUTPUT_FULL)
+        display_io_statistics(processes, count);
+}
 
-                // 첫 번째 도착인지 주기적 도착인지 확인하여 deadline 설정
-                if (time == original_processes[i].arrival_time) {
-                    // 첫 번째 도착 - 원본 deadline 사용
-                    new_process.deadline = original_processes[i].deadline;
-                } else {
-                    // 주기적 도착 - deadline 계산
-                    int period_count =
-                        (time - original_processes[i].arrival_time) /
-                        original_processes[i].period;
-                    new_process.deadline =
-                        original_processes[i].deadline +
-                        period_count * original_processes[i].period;
-                }
+// 시뮬레이션 결과 출력 (level에 따라 간트차트와 표를 생략)
+static void print_simulation_report(SchedulingPolicy policy,
+                                    Process *processes, int count,
+                                    Config *config, SimulationResult *result,
+                                    OutputLevel level) {
+    const char *title = "";
+    const char *algorithm_name = "";
+
+    switch (policy) {
+    case POLICY_FCFS:
+        title = "FCFS Scheduling with Multi-I/O";
+        algorithm_name = "FCFS Multi-I/O";
+        break;
+    case POLICY_SJF_NP:
+        title = "Non-Preemptive SJF Scheduling with Multi-I/O";
+        algorithm_name = "Non-Preemptive SJF Multi-I/O";
+        break;
+    case POLICY_SJF_P:
+        title = "Preemptive SJF Scheduling with Multi-I/O";
+        algorithm_name = "Preemptive SJF Multi-I/O";
+        break;
+    case POLICY_PRIORITY_NP:
+        title = "Non-Preemptive Priority Scheduling with Multi-I/O";
+        algorithm_name = "Non-Preemptive Priority Multi-I/O";
+        break;
+    case POLICY_PRIORITY_P:
+        title = "Preemptive Priority Scheduling with Multi-I/O";
+        algorithm_name = "Preemptive Priority Multi-I/O";
+        break;
+    case POLICY_RR:
+        title = "Round Robin Scheduling with Multi-I/O";
+        algorithm_name = "Round Robin Multi-I/O";
+        break;
+    case POLICY_PRIORITY_AGING:
+        title = "Priority Scheduling with Aging(Preemptive) and Multi-I/O";
+        algorithm_name = "Priority with Aging Multi-I/O";
+        break;
+    case POLICY_RMS:
+        title = "Rate Monotonic Scheduling with Multi-I/O";
+        algorithm_name = "Rate Monotonic Scheduling Multi-I/O";
+        break;
+    case POLICY_EDF:
+        title = "Earliest Deadline First Scheduling with Multi-I/O";
+        algorithm_name = "Earliest Deadline First Multi-I/O";
+        break;
+    }
 
-                new_process.progress = 0;
-                new_process.waiting_time_counter = 0;
-                new_process.comp_time = 0;
-                new_process.waiting_time = 0;
-                new_process.turnaround_time = 0;
-                new_process.missed_deadline = 0;
+    printf("\n");
+    print_thin_emphasized_header(title, 150);
+    printf("\n");
 
-                // all_processes 배열에 추가
-                all_processes[total_process_count] = new_process;
+    if (policy == POLICY_RR) {
+        printf("** Time Quantum: %d **\n\n", config->time_quantum);
+    } else if (policy == POLICY_PRIORITY_AGING && level == OUTPUT_FULL) {
+        print_aging_log(result);
+    }
 
-                // 다음 도착 시간 업데이트
-                next_arrival[i] += original_processes[i].period;
+    if (is_real_time_policy(policy)) {
+        if (level == OUTPUT_FULL) {
+            print_real_time_tables(policy, processes, count);
+            print_deadline_misses(result);
+        }
 
-                // 스케줄링 결정 (deadline 기준)
-                if (!is_empty(&running_q)) {
-                    int current_running = peek(&running_q);
-                    if (all_processes[total_process_count].deadline <
-                        all_processes[current_running].deadline) {
-                        int preempted = dequeue(&running_q);
-                        enqueue(&ready_q, preempted);
-                        enqueue(&running_q, total_process_count);
-                    } else {
-                        // 단순 enqueue (나중에 일괄 정렬)
-                        enqueue(&ready_q, total_process_count);
-                    }
-                } else {
-                    // 단순 enqueue (나중에 일괄 정렬)
-                    enqueue(&ready_q, total_process_count);
-                }
+        printf("** Total Deadline Misses: %d **\n",
+               config->deadline_miss_info_count);
 
-                total_process_count++;
-            }
+        // 태스크를 나눈 결과와 코어별 데드라인 미스
+        if (result->core_count > 1 &&
+            config->cpu.dispatch == DISPATCH_PARTITIONED) {
+            print_partition_table(
+                processes, count, result->core_count, config->cpu.partition,
+                policy == POLICY_RMS ? CORE_TEST_RMS : CORE_TEST_EDF,
+                result->core_misses);
         }
 
-        // I/O 완료 처리
-        for (int i = 0; i < total_process_count; i++) {
-            if (waiting_q[i] > 0) {
-                waiting_q[i]--;
-                if (waiting_q[i] == 0) {
-                    // I/O 완료 후 스케줄링 결정
-                    if (!is_empty(&running_q)) {
-                        int current_running = peek(&running_q);
-                        if (all_processes[i].deadline <
-                            all_processes[current_running].deadline) {
-                            int preempted = dequeue(&running_q);
-                            enqueue(&ready_q, preempted);
-                            enqueue(&running_q, i);
-                        } else {
-                            enqueue(&ready_q, i);
-                        }
-                    } else {
-                        enqueue(&ready_q, i);
-                    }
-                    waiting_q[i] = -1;
-                }
-            }
-        }
+        // 모든 프로세스 인스턴스를 포함하여 결과 출력
+        processes = result->instances;
+        count = result->instance_count;
+    }
 
-        // Ready queue를 deadline 기준으로 정렬 (CPU 할당 직전에 일괄 정렬)
-        if (!is_empty(&ready_q)) {
-            sort_queue(&ready_q, all_processes, SORT_BY_DEADLINE);
-        }
+    if (result->core_count > 1) {
+        print_multicore_report(processes, count, config, result,
+                               algorithm_name, level);
+    } else if (level == OUTPUT_FULL) {
+        display_scheduling_results(
+            processes, result->outcomes, count, &result->gantt,
+            result->total_time, result->idle_time, result->switches,
+            result->overhead_time, algorithm_name);
+    } else {
+        display_performance_summary(processes, result->outcomes, count,
+                                    result->total_time, result->idle_time, 1,
+                                    result->switches, result->overhead_time);
+    }
+}
 
-        // CPU 스케줄링 (Ready → Running)
-        if (is_empty(&running_q) && !is_empty(&ready_q)) {
-            int next_process = dequeue(&ready_q); // 이미 정렬되어 있으므로 첫
-                                                  // 번째가 가장 빠른 deadline
-            enqueue(&running_q, next_process);
-        }
+// 끝난 시뮬레이션의 결과를 출력하고 Metrics로 정리 (result는 해제됨)
+// 반환된 Metrics는 호출한 쪽에서 free
+// config->output_level이 OUTPUT_METRICS이면 아무것도 출력하지 않는다
+Metrics *report_simulation(SchedulingPolicy policy, Process *processes,
+                           int count, Config *config,
+                           SimulationResult *result) {
+    OutputLevel level = config ? config->output_level : OUTPUT_FULL;
 
-        // 프로세스 실행
-        if (is_empty(&running_q)) {
-            add_gantt_entry(&gantt, time, time + 1, -1, "IDLE");
-            idle_time++;
-        } else {
-            int current_running = peek(&running_q);
-            // Gantt 차트에는 실제 PID를 사용
-            add_gantt_entry(&gantt, time, time + 1,
-                            all_processes[current_running].pid, "RUN");
+    Metrics *metrics = malloc(sizeof(Metrics));
+    metrics->total_time = result->total_time;
+    metrics->idle_time = result->idle_time;
 
-            all_processes[current_running].progress++;
+    if (is_real_time_policy(policy)) {
+        config->deadline_miss_info_count = result->miss_count;
+    }
 
-            // 멀티 I/O 처리: 현재 진행도에서 I/O가 시작되는지 확인
-            if (has_io_at_progress(&all_processes[current_running],
-                                   all_processes[current_running].progress)) {
-                int io_process = current_running;
-                int io_burst = get_io_burst_at_progress(
-                    &all_processes[io_process],
-                    all_processes[io_process].progress);
-                waiting_q[io_process] = io_burst + 1;
-                dequeue(&running_q);
-            }
-            // 프로세스 완료 처리
-            else if (all_processes[current_running].progress ==
-                     all_processes[current_running].cpu_burst) {
-                int finished = current_running;
-                all_processes[finished].comp_time = time + 1;
-                all_processes[finished].turnaround_time =
-                    all_processes[finished].comp_time -
-                    all_processes[finished].arrival_time;
-                all_processes[finished].waiting_time =
-                    all_processes[finished].waiting_time_counter;
+    if (level != OUTPUT_METRICS) {
+        print_simulation_report(policy, processes, count, config, result,
+                                level);
+    }
 
-                // 데드라인 미스 체크
-                if (all_processes[finished].comp_time >
-                    all_processes[finished].deadline) {
-                    deadline_miss_info[config->deadline_miss_info_count].pid =
-                        all_processes[finished].pid; // 실제 PID 사용
-                    deadline_miss_info[config->deadline_miss_info_count]
-                        .absolute_deadline = all_processes[finished].deadline;
-                    deadline_miss_info[config->deadline_miss_info_count]
-                        .completion_time = all_processes[finished].comp_time;
+    free_simulation_result(result);
 
-                    all_processes[finished].missed_deadline = 1;
-                    config->deadline_miss_info_count++;
-                    has_missed = 1;
+    return metrics;
+}
 
-                    printf("| %4d | P%-10d | %-16d | %-15d |\n", time + 1,
-                           all_processes[finished].pid,
-                           all_processes[finished].deadline,
-                           all_processes[finished].comp_time);
-                }
+Metrics *run_policy(SchedulingPolicy policy, Process *processes, int count,
+                    Config *config, int max_time) {
+    SchedState state;
+    SimulationResult result;
+    init_sched_state(&state, count);
+    simulate_policy(policy, processes, count, config, max_time, &state,
+                    &result);
+    Metrics *metrics =
+        report_simulation(policy, processes, count, config, &result);
+    free_sched_state(&state);
+    return metrics;
+}
 
-                dequeue(&running_q);
-            }
-        }
+Metrics *run_fcfs(Process *processes, int count) {
+    return run_policy(POLICY_FCFS, processes, count, NULL, 0);
+}
 
-        // Ready queue의 프로세스들만 대기시간 증가
-        if (!is_empty(&ready_q)) {
-            for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-                 cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-                int pid = ready_q.data[i];
-                all_processes[pid].waiting_time_counter++;
-            }
-        }
+Metrics *run_sjf_np(Process *processes, int count) {
+    return run_policy(POLICY_SJF_NP, processes, count, NULL, 0);
+}
 
-        // 디버깅용 ready queue 상태 출력
-        // if (!is_empty(&ready_q)) {
-        //     printf("Time %d Ready Queue (Deadline order): ", time);
-        //     for (int i = ready_q.front, cnt = 0; cnt < ready_q.count;
-        //          cnt++, i = (i + 1) % MAX_QUEUE_SIZE) {
-        //         int pid = ready_q.data[i];
-        //         printf("P%d(pr:%d) ", all_processes[pid].pid,
-        //                all_processes[pid].period);
-        //     }
-        // }
+Metrics *run_sjf_p(Process *processes, int count) {
+    return run_policy(POLICY_SJF_P, processes, count, NULL, 0);
+}
 
-        time++;
-    }
+Metrics *run_priority_np(Process *processes, int count) {
+    return run_policy(POLICY_PRIORITY_NP, processes, count, NULL, 0);
+}
 
-    if (!has_missed) {
-        printf("|                There is no deadline miss                |\n");
-    }
-    printf("+------+-------------+------------------+-----------------+\n\n");
+Metrics *run_priority_p(Process *processes, int count) {
+    return run_policy(POLICY_PRIORITY_P, processes, count, NULL, 0);
+}
 
-    metrics->total_time = time;
-    metrics->idle_time = idle_time;
-    metrics->for_edf_rms_processes = all_processes;
-    metrics->for_edf_rms_counter = total_process_count;
-    printf("** Total Deadline Misses: %d **\n",
-           config->deadline_miss_info_count);
+Metrics *run_rr(Process *processes, int count, Config *config) {
+    return run_policy(POLICY_RR, processes, count, config, 0);
+}
 
-    // 모든 프로세스 인스턴스를 포함하여 결과 출력
-    display_scheduling_results(all_processes, total_process_count, &gantt, time,
-                               idle_time, "Earliest Deadline First Multi-I/O");
+Metrics *run_priority_with_aging(Process *processes, int count) {
+    return run_policy(POLICY_PRIORITY_AGING, processes, count, NULL, 0);
+}
 
-    free(gantt.entries);
-    free(original_processes);
-    free(all_processes);
-    free(next_arrival);
-    free(deadline_miss_info);
-    free(waiting_q);
+Metrics *run_rms(Process *processes, int count, Config *config, int max_time) {
+    return run_policy(POLICY_RMS, processes, count, config, max_time);
+}
 
-    return metrics;
+Metrics *run_edf(Process *processes, int count, Config *config, int max_time) {
+    return run_policy(POLICY_EDF, processes, count, config, max_time);
 }
@@ -0,0 +1,169 @@
+#include "sweep.h"
+#include "engine.h"
+#include "parallel.h"
+#include <stdlib.h>
+
+// 범위에 들어가는 퀀텀을 오름차순으로 quanta에 채우고 개수를 반환
+// seq처럼 격자 위의 값만 쓰므로 last가 격자에 없으면 그 앞에서 멈춘다
+// 로그 스케일에서 반올림한 값이 그대로면 1 늘려, 매 단계 퀀텀이 커진다
+// (SWEEP_MAX_QUANTA개를 넘으면 -1)
+int quantum_range_values(const QuantumRange *range, int *quanta) {
+    int count = 0;
+    long long quantum = range->first;
+    double value = range->first;
+
+    while (quantum <= range->last) {
+        if (count == SWEEP_MAX_QUANTA)
+            return -1;
+        quanta[count++] = (int)quantum;
+
+        if (range->factor > 0.0) {
+            value *= range->factor;
+            if (value < quantum + 1)
+                value = quantum + 1;
+            quantum = (long long)(value + 0.5);
+        } else {
+            quantum += range->step;
+        }
+    }
+    return count;
+}
+
+typedef struct {
+    const Process *processes;
+    int count;
+    const int *quanta;
+    const CpuConfig *cpu;
+    SweepPoint *points;
+} SweepBatch;
+
+// 퀀텀 하나로 RR을 시뮬레이션 (간트차트 등 기록 없이 합계만)
+static void run_sweep_task(void *arg, int index) {
+    SweepBatch *batch = (SweepBatch *)arg;
+    SweepPoint *point = &batch->points[index];
+    SchedState state;
+    SimulationResult result;
+
+    init_sched_state(&state, batch->count);
+    simulate(POLICY_RR, batch->processes, batch->count, batch->quanta[index],
+             -1, 0, batch->cpu, &state, &result);
+
+    int completed = result.completed;
+    point->quantum = batch->quanta[index];
+    point->avg_waiting =
+        completed > 0 ? (double)result.total_waiting / completed : 0.0;
+    point->avg_turnaround =
+        completed > 0 ? (double)result.total_turnaround / completed : 0.0;
+    point->avg_response =
+        completed > 0 ? (double)result.total_response / completed : 0.0;
+    point->switches = result.switches;
+    point->overhead_time = result.overhead_time;
+    point->total_time = result.total_time;
+
+    free_simulation_result(&result);
+    free_sched_state(&state);
+}
+
+// quanta의 퀀텀마다 RR을 병렬로 시뮬레이션해 points[i]에 결과를 기록
+// 워크로드는 읽기만 하므로 모든 실행이 공유하고, 상태는 실행마다 따로 둔다
+void sweep_quantum(const Process *processes, int count, const int *quanta,
+                   int quantum_count, const CpuConfig *cpu,
+                   int worker_threads, SweepPoint *points) {
+    SweepBatch batch = {processes, count, quanta, cpu, points};
+    parallel_for(quantum_count, worker_threads, run_sweep_task, &batch);
+}
+
+// 목표별 최적 퀀텀의 인덱스 (값이 같으면 작은 퀀텀)
+static int best_index(const SweepPoint *points, int count,
+                      double (*objective)(const SweepPoint *)) {
+    int best = 0;
+    for (int i = 1; i < count; i++) {
+        if (objective(&points[i]) < objective(&points[best]))
+            best = i;
+    }
+    return best;
+}
+
+static double waiting_of(const SweepPoint *p) { return p->avg_waiting; }
+static double turnaround_of(const SweepPoint *p) { return p->avg_turnaround; }
+static double response_of(const SweepPoint *p) { return p->avg_response; }
+static double switches_of(const SweepPoint *p) { return p->switches; }
+
+typedef struct {
+    const char *key;   // CSV/JSON 이름
+    const char *label; // 텍스트 출력 이름
+    double (*value)(const SweepPoint *);
+    int precision; // 텍스트 출력의 소수점 자릿수
+} SweepObjective;
+
+static const SweepObjective objectives[] = {
+    {"avg_wait_time", "waiting time", waiting_of, 2},
+    {"avg_turnaround_time", "turnaround time", turnaround_of, 2},
+    {"avg_response_time", "response time", response_of, 2},
+    {"switches", "context switches", switches_of, 0},
+};
+
+#define OBJECTIVE_COUNT ((int)(sizeof(objectives) / sizeof(objectives[0])))
+
+// 퀀텀별 결과 표와 목표별 최적 퀀텀 출력
+void write_sweep_results(FILE *fp, const SweepPoint *points, int count,
+                         OutputFormat format) {
+    if (format == OUTPUT_CSV) {
+        fprintf(fp, "quantum,avg_wait_time,avg_turnaround_time,"
+                    "avg_response_time,switches,overhead_time,total_time\n");
+        for (int i = 0; i < count; i++) {
+            const SweepPoint *p = &points[i];
+            fprintf(fp, "%d,%.4f,%.4f,%.4f,%d,%d,%d\n", p->quantum,
+                    p->avg_waiting, p->avg_turnaround, p->avg_response,
+                    p->switches, p->overhead_time, p->total_time);
+        }
+        return;
+    }
+
+    if (format == OUTPUT_JSON) {
+        fprintf(fp, "{\n  \"points\": [\n");
+        for (int i = 0; i < count; i++) {
+            const SweepPoint *p = &points[i];
+            fprintf(fp,
+                    "    {\"quantum\": %d, \"avg_wait_time\": %.4f, "
+                    "\"avg_turnaround_time\": %.4f, "
+                    "\"avg_response_time\": %.4f, \"switches\": %d, "
+                    "\"overhead_time\": %d, \"total_time\": %d}%s\n",
+                    p->quantum, p->avg_waiting, p->avg_turnaround,
+                    p->avg_response, p->switches, p->overhead_time,
+                    p->total_time, i + 1 < count ? "," : "");
+        }
+        fprintf(fp, "  ],\n  \"best_quantum\": {");
+        for (int i = 0; i < OBJECTIVE_COUNT; i++) {
+            int best = best_index(points, count, objectives[i].value);
+            fprintf(fp, "%s\"%s\": %d", i > 0 ? ", " : "", objectives[i].key,
+                    points[best].quantum);
+        }
+        fprintf(fp, "}\n}\n");
+        return;
+    }
+
+    fprintf(fp, "\n** Round Robin Quantum Sweep (%d quanta) **\n", count);
+    fprintf(fp, "+---------+---------------+------------------+--------------"
+                "+----------+----------+------------+\n");
+    fprintf(fp, "| Quantum | Avg Wait Time | Avg Turnaround   | Avg Response "
+                "| Switches | Overhead | Total Time |\n");
+    fprintf(fp, "+---------+---------------+------------------+--------------"
+                "+----------+----------+------------+\n");
+    for (int i = 0; i < count; i++) {
+        const SweepPoint *p = &points[i];
+        fprintf(fp, "| %7d | %13.2f | %16.2f | %12.2f | %8d | %8d | %10d |\n",
+                p->quantum, p->avg_waiting, p->avg_turnaround,
+                p->avg_response, p->switches, p->overhead_time,
+                p->total_time);
+    }
+    fprintf(fp, "+---------+---------------+------------------+--------------"
+                "+----------+----------+------------+\n");
+
+    for (int i = 0; i < OBJECTIVE_COUNT; i++) {
+        int best = best_index(points, count, objectives[i].value);
+        fprintf(fp, "- Best quantum for %s: %d (%.*f)\n",
+                objectives[i].label, points[best].quantum,
+                objectives[i].precision, objectives[i].value(&points[best]));
+    }
+}
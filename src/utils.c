@@ -1,104 +1,128 @@
 #include "utils.h"
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
-// 두 프로세스를 비교하는 함수 (작은 값이 우선순위가 높음)
-int compare_processes(Process *processes, int pid1, int pid2, SortCriteria criteria) {
+// ready queue 정렬 키의 초기값 (작을수록 우선순위가 높음)
+// SJF의 남은 시간과 aging 우선순위는 엔진이 실행 중에 갱신한다
+int sort_key(const Process *p, SortCriteria criteria) {
     switch (criteria) {
         case SORT_BY_PRIORITY:
-            return processes[pid1].priority - processes[pid2].priority;
+            return p->priority;
 
         case SORT_BY_REMAINING_TIME:
-            return (processes[pid1].cpu_burst - processes[pid1].progress) -
-                   (processes[pid2].cpu_burst - processes[pid2].progress);
+            return p->cpu_burst;
 
         case SORT_BY_DEADLINE:
-            return processes[pid1].deadline - processes[pid2].deadline;
+            return p->deadline;
 
         case SORT_BY_PERIOD:
-            return processes[pid1].period - processes[pid2].period;
+            return p->period;
 
         default:
             return 0;
     }
 }
 
-// 큐를 정렬하는 함수
-void sort_queue(Queue *queue, Process *processes, SortCriteria criteria) {
-    if (is_empty(queue) || queue->count <= 1) {
-        return;  // 빈 큐이거나 원소가 1개 이하면 정렬할 필요 없음
-    }
-
-    // 큐의 모든 원소를 임시 배열에 복사
-    int *temp_array = (int *)malloc(sizeof(int) * queue->count);
-    int temp_count = 0;
-
-    // 큐에서 모든 원소를 꺼내서 배열에 저장
-    while (!is_empty(queue)) {
-        temp_array[temp_count++] = dequeue(queue);
-    }
-
-    // 버블 정렬로 배열 정렬 (간단한 구현)
-    for (int i = 0; i < temp_count - 1; i++) {
-        for (int j = 0; j < temp_count - i - 1; j++) {
-            if (compare_processes(processes, temp_array[j], temp_array[j + 1], criteria) > 0) {
-                // 교환
-                int temp = temp_array[j];
-                temp_array[j] = temp_array[j + 1];
-                temp_array[j + 1] = temp;
-            }
+// io_start 기준 오름차순 정렬
+// 같은 시작 시점끼리는 입력 순서를 유지하도록 삽입 정렬을 사용
+// (파일 입력은 대부분 이미 정렬되어 있어 거의 선형 시간)
+void sort_io_operations(IOOperation *ops, int count) {
+    for (int i = 1; i < count; i++) {
+        IOOperation op = ops[i];
+        int j = i;
+        while (j > 0 && ops[j - 1].io_start > op.io_start) {
+            ops[j] = ops[j - 1];
+            j--;
         }
+        ops[j] = op;
     }
+}
 
-    // 정렬된 배열을 다시 큐에 삽입
-    for (int i = 0; i < temp_count; i++) {
-        enqueue(queue, temp_array[i]);
+void init_io_arena(IOArena *arena, long capacity) {
+    arena->ops = NULL;
+    arena->count = 0;
+    arena->capacity = 0;
+    if (capacity > 0) {
+        arena->ops = (IOOperation *)malloc(sizeof(IOOperation) * capacity);
+        if (!arena->ops) {
+            perror("I/O arena");
+            exit(1);
+        }
+        arena->capacity = capacity;
     }
+}
 
-    free(temp_array);
+void free_io_arena(IOArena *arena) {
+    free(arena->ops);
+    arena->ops = NULL;
+    arena->count = 0;
+    arena->capacity = 0;
 }
 
-void sort_io_operations(Process *p) {
-    // 버블 정렬을 사용하여 io_start 기준으로 오름차순 정렬
-    for (int i = 0; i < MAX_IO_OPERATIONS - 1; i++) {
-        for (int j = 0; j < MAX_IO_OPERATIONS - i - 1; j++) {
-            // 둘 다 유효한 I/O 작업인 경우에만 비교
-            if (p->io_operations[j].io_start != -1 &&
-                p->io_operations[j + 1].io_start != -1) {
-
-                // io_start 기준으로 정렬 (작은 값이 앞에 오도록)
-                if (p->io_operations[j].io_start >
-                    p->io_operations[j + 1].io_start) {
-                    // 두 I/O 작업 교환
-                    IOOperation temp = p->io_operations[j];
-                    p->io_operations[j] = p->io_operations[j + 1];
-                    p->io_operations[j + 1] = temp;
-                }
-            }
+// I/O 작업 여러 개를 배열 끝에 추가 (모자라면 두 배로 늘림)
+void append_io_operations(IOArena *arena, const IOOperation *ops, int count) {
+    if (count <= 0)
+        return;
+    if (arena->count + count > arena->capacity) {
+        long capacity = arena->capacity ? arena->capacity : 16;
+        while (capacity < arena->count + count)
+            capacity *= 2;
+        arena->ops =
+            (IOOperation *)realloc(arena->ops, sizeof(IOOperation) * capacity);
+        if (!arena->ops) {
+            perror("I/O arena");
+            exit(1);
         }
+        arena->capacity = capacity;
     }
+    memcpy(&arena->ops[arena->count], ops, sizeof(IOOperation) * count);
+    arena->count += count;
 }
 
-
 // I/O 작업 추가 함수
-void add_io_to_process(Process *p, int io_start, int io_burst) {
-    for (int i = 0; i < MAX_IO_OPERATIONS; i++) {
-        if (p->io_operations[i].io_start == -1) {
-            p->io_operations[i].io_start = io_start;
-            p->io_operations[i].io_burst = io_burst;
-            break;
-        }
+// 프로세스를 만드는 동안에는 자기 I/O가 배열 끝에 이어 붙으므로 개수만 센다
+// (위치는 attach_io_arena에서 연결)
+void add_io_to_process(IOArena *arena, Process *p, int io_start,
+                       int io_burst) {
+    IOOperation op = {io_start, io_burst};
+    append_io_operations(arena, &op, 1);
+    p->io_count++;
+}
+
+// 만든 순서대로 I/O를 추가한 프로세스 배열에 공유 I/O 배열을 연결
+// I/O 배열은 프로세스 배열과 같은 블록 뒤쪽으로 옮기므로
+// 호출한 쪽은 지금처럼 free(processes) 한 번으로 모두 해제할 수 있다
+// arena는 비워지며, 실패하면 NULL (processes는 그대로 남음)
+Process *attach_io_arena(Process *processes, int count, IOArena *arena) {
+    size_t process_size = sizeof(Process) * count;
+    Process *block = (Process *)realloc(
+        processes, process_size + sizeof(IOOperation) * arena->count);
+    if (!block) {
+        perror("I/O arena");
+        return NULL;
     }
+
+    IOOperation *ops = (IOOperation *)((char *)block + process_size);
+    if (arena->count > 0)
+        memcpy(ops, arena->ops, sizeof(IOOperation) * arena->count);
+    free_io_arena(arena);
+
+    long offset = 0;
+    for (int i = 0; i < count; i++) {
+        block[i].io_operations = &ops[offset];
+        offset += block[i].io_count;
+    }
+    return block;
 }
 
-// I/O 작업 개수 반환
-int get_io_count(Process *p) {
-    int count = 0;
-    for (int i = 0; i < MAX_IO_OPERATIONS; i++) {
-        if (p->io_operations[i].io_start != -1) {
-            count++;
-        }
+// 프로세스의 전체 I/O 시간
+int get_total_io_time(const Process *p) {
+    int total = 0;
+    for (int i = 0; i < p->io_count; i++) {
+        total += p->io_operations[i].io_burst;
     }
-    return count;
+    return total;
 }
 
 
@@ -112,22 +136,31 @@ int is_time_used(int *used_times, int count, int time) {
     return 0;
 }
 
-// 특정 진행도에서 I/O가 시작되는지 확인
-int has_io_at_progress(Process *p, int progress) {
-    for (int i = 0; i < MAX_IO_OPERATIONS; i++) {
-        if (p->io_operations[i].io_start == progress) {
-            return 1;
-        }
+// I/O 작업은 io_start 순으로 정렬되어 있으므로 커서만 앞으로 옮기면 된다
+// 이미 지난 (io_start <= progress) 작업은 건너뜀
+static inline void skip_past_io(const Process *p, int progress, int *cursor) {
+    while (*cursor < p->io_count &&
+           p->io_operations[*cursor].io_start <= progress) {
+        (*cursor)++;
     }
-    return 0;
 }
 
-// 특정 진행도에서의 I/O 버스트 시간 반환
-int get_io_burst_at_progress(Process *p, int progress) {
-    for (int i = 0; i < MAX_IO_OPERATIONS; i++) {
-        if (p->io_operations[i].io_start == progress) {
-            return p->io_operations[i].io_burst;
-        }
-    }
-    return 0;
+// progress 이후 처음으로 I/O가 시작되는 진행도 반환 (없으면 -1)
+int next_io_start(const Process *p, int progress, int *cursor) {
+    skip_past_io(p, progress, cursor);
+    if (*cursor >= p->io_count)
+        return -1;
+    return p->io_operations[*cursor].io_start;
+}
+
+// 현재 진행도에서 I/O가 시작되면 버스트 시간을 io_burst에 넣고 커서를 넘김
+// (next_io_start 이후 progress가 그 지점까지 진행했을 때 호출, I/O가 있으면 1)
+int take_io_at_progress(const Process *p, int progress, int *cursor,
+                        int *io_burst) {
+    if (*cursor >= p->io_count ||
+        p->io_operations[*cursor].io_start != progress)
+        return 0;
+    *io_burst = p->io_operations[*cursor].io_burst;
+    skip_past_io(p, progress, cursor);
+    return 1;
 }
@@ -0,0 +1,419 @@
+#include "workload.h"
+#include "utils.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static int fill_buffer(WorkloadReader *reader) {
+    if (reader->eof)
+        return 0;
+
+    ssize_t n = read(reader->fd, reader->buffer, WORKLOAD_BUFFER_SIZE);
+    if (n < 0)
+        perror(reader->path);
+    if (n <= 0) {
+        reader->eof = 1;
+        return 0;
+    }
+    reader->size = (int)n;
+    reader->pos = 0;
+    return 1;
+}
+
+// 다음 문자 (파일 끝이면 -1)
+static inline int next_char(WorkloadReader *reader) {
+    if (reader->pos >= reader->size && !fill_buffer(reader))
+        return -1;
+    return (unsigned char)reader->buffer[reader->pos++];
+}
+
+static inline int is_blank(int c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+// 공백으로 구분된 정수 하나 파싱 (성공 1, 파일 끝 0, 형식 오류 -1)
+static int parse_int(WorkloadReader *reader, int *out) {
+    int c = next_char(reader);
+    while (is_blank(c)) {
+        if (c == '\n')
+            reader->line++;
+        c = next_char(reader);
+    }
+    if (c == -1)
+        return 0;
+
+    int negative = 0;
+    if (c == '-') {
+        negative = 1;
+        c = next_char(reader);
+    }
+    if (c < '0' || c > '9') {
+        printf("%s:%ld: expected an integer\n", reader->path, reader->line);
+        return -1;
+    }
+
+    long value = 0;
+    while (c >= '0' && c <= '9') {
+        value = value * 10 + (c - '0');
+        if (value > INT_MAX) {
+            printf("%s:%ld: integer out of range\n", reader->path,
+                   reader->line);
+            return -1;
+        }
+        c = next_char(reader);
+    }
+
+    if (c == '\n') {
+        reader->line++;
+    } else if (c != -1 && !is_blank(c)) {
+        printf("%s:%ld: expected an integer\n", reader->path, reader->line);
+        return -1;
+    }
+
+    *out = negative ? (int)-value : (int)value;
+    return 1;
+}
+
+// 값 여러 개를 연속으로 읽기 (모두 읽으면 1)
+static int parse_ints(WorkloadReader *reader, int *values, int n,
+                      const char *what) {
+    for (int i = 0; i < n; i++) {
+        int status = parse_int(reader, &values[i]);
+        if (status == 1)
+            continue;
+        if (status == 0) {
+            printf("%s:%ld: unexpected end of file while reading %s\n",
+                   reader->path, reader->line, what);
+        }
+        return 0;
+    }
+    return 1;
+}
+
+// 바이너리 파일을 mmap하고 헤더 검증 (성공 0, 실패 -1)
+static int open_binary(WorkloadReader *reader) {
+    struct stat st;
+    if (fstat(reader->fd, &st) != 0) {
+        perror(reader->path);
+        return -1;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, reader->fd, 0);
+    if (map == MAP_FAILED) {
+        perror(reader->path);
+        return -1;
+    }
+    madvise(map, size, MADV_SEQUENTIAL);
+    reader->map = map;
+    reader->map_size = size;
+
+    const WorkloadHeader *header = (const WorkloadHeader *)map;
+    if (header->version != WORKLOAD_VERSION) {
+        printf("%s: unsupported workload version %u\n", reader->path,
+               header->version);
+        return -1;
+    }
+
+    size_t records_size =
+        (size_t)header->process_count * sizeof(WorkloadRecord);
+    size_t io_size = (size_t)header->io_count * sizeof(WorkloadIO);
+    if (header->process_count == 0 || header->process_count > INT_MAX ||
+        size < sizeof(WorkloadHeader) + records_size + io_size) {
+        printf("%s: truncated or corrupt workload file\n", reader->path);
+        return -1;
+    }
+
+    reader->records =
+        (const WorkloadRecord *)((const char *)map + sizeof(WorkloadHeader));
+    reader->io_table =
+        (const WorkloadIO *)((const char *)reader->records + records_size);
+    reader->io_count = header->io_count;
+    reader->declared_count = (int)header->process_count;
+    return 0;
+}
+
+// 파일을 열고 형식을 판별해 프로세스 수를 읽음 (성공 0, 실패 -1)
+// 앞 4바이트가 WORKLOAD_MAGIC이면 바이너리, 아니면 텍스트 형식
+int open_workload(WorkloadReader *reader, const char *path) {
+    memset(reader, 0, sizeof(WorkloadReader));
+    reader->path = path;
+    reader->line = 1;
+
+    reader->fd = open(path, O_RDONLY);
+    if (reader->fd < 0) {
+        printf("Cannot open file: %s\n", path);
+        return -1;
+    }
+
+    char magic[sizeof(WorkloadHeader)];
+    ssize_t n = pread(reader->fd, magic, sizeof(magic), 0);
+    if (n == (ssize_t)sizeof(magic) &&
+        memcmp(magic, WORKLOAD_MAGIC, 4) == 0) {
+        reader->format = WORKLOAD_BINARY;
+        if (open_binary(reader) != 0) {
+            close_workload(reader);
+            return -1;
+        }
+        return 0;
+    }
+
+    reader->format = WORKLOAD_TEXT;
+    reader->buffer = malloc(WORKLOAD_BUFFER_SIZE);
+    if (reader->buffer == NULL) {
+        perror("workload buffer");
+        close_workload(reader);
+        return -1;
+    }
+
+    if (!parse_ints(reader, &reader->declared_count, 1, "process count") ||
+        reader->declared_count <= 0) {
+        printf("Failed to read process count from file.\n");
+        close_workload(reader);
+        return -1;
+    }
+    return 0;
+}
+
+static int read_text_process(WorkloadReader *reader, Process *p) {
+    // PID 도착시간 CPU버스트 우선순위 데드라인 주기 IO개수
+    int fields[7];
+    if (!parse_ints(reader, fields, 7, "process info")) {
+        printf("Failed to read process %d basic info from file.\n",
+               reader->read_count);
+        return -1;
+    }
+
+    p->pid = fields[0];
+    p->arrival_time = fields[1];
+    p->cpu_burst = fields[2];
+    p->priority = fields[3];
+    p->deadline = fields[4];
+    p->period = fields[5];
+    int io_count = fields[6];
+
+    if (io_count < 0) {
+        printf("%s:%ld: negative I/O count for process %d\n", reader->path,
+               reader->line, reader->read_count);
+        return -1;
+    }
+
+    // I/O 작업은 리더의 임시 배열에 읽음
+    init_process_io(p);
+    reader->io_buffer.count = 0;
+    for (int j = 0; j < io_count; j++) {
+        int io[2];
+        if (!parse_ints(reader, io, 2, "I/O info")) {
+            printf("Failed to read I/O %d info for process %d from file.\n",
+                   j, reader->read_count);
+            return -1;
+        }
+        add_io_to_process(&reader->io_buffer, p, io[0], io[1]);
+    }
+    p->io_operations = reader->io_buffer.ops;
+    sort_io_operations(p->io_operations, p->io_count);
+    return 1;
+}
+
+static int read_binary_process(WorkloadReader *reader, Process *p) {
+    const WorkloadRecord *record = &reader->records[reader->read_count];
+
+    if (record->io_offset > reader->io_count ||
+        record->io_count > reader->io_count - record->io_offset ||
+        record->io_count > INT_MAX) {
+        printf("%s: process %d has an I/O range outside the I/O table\n",
+               reader->path, reader->read_count);
+        return -1;
+    }
+
+    p->pid = record->pid;
+    p->arrival_time = record->arrival_time;
+    p->cpu_burst = record->cpu_burst;
+    p->priority = record->priority;
+    p->deadline = record->deadline;
+    p->period = record->period;
+
+    // 변환기는 io_start 순으로 저장하지만 직접 만든 파일도 있으므로
+    // 텍스트 형식과 같이 정렬한다 (이미 정렬되어 있으면 거의 비용 없음)
+    init_process_io(p);
+    reader->io_buffer.count = 0;
+    const WorkloadIO *io = &reader->io_table[record->io_offset];
+    for (uint32_t j = 0; j < record->io_count; j++) {
+        add_io_to_process(&reader->io_buffer, p, io[j].io_start,
+                          io[j].io_burst);
+    }
+    p->io_operations = reader->io_buffer.ops;
+    sort_io_operations(p->io_operations, p->io_count);
+    return 1;
+}
+
+// 다음 프로세스 하나를 읽음 (성공 1, 모두 읽음 0, 오류 -1)
+// p->io_operations는 리더 내부 배열을 가리키므로 다음 호출 전에 복사해야 함
+int read_workload_process(WorkloadReader *reader, Process *p) {
+    if (reader->read_count >= reader->declared_count)
+        return 0;
+
+    int status = reader->format == WORKLOAD_BINARY
+                     ? read_binary_process(reader, p)
+                     : read_text_process(reader, p);
+    if (status != 1)
+        return -1;
+
+    reader->read_count++;
+    return 1;
+}
+
+void close_workload(WorkloadReader *reader) {
+    free(reader->buffer);
+    reader->buffer = NULL;
+    free_io_arena(&reader->io_buffer);
+    if (reader->map)
+        munmap(reader->map, reader->map_size);
+    reader->map = NULL;
+    if (reader->fd >= 0)
+        close(reader->fd);
+    reader->fd = -1;
+}
+
+// 텍스트 형식으로 프로세스 하나 저장
+// PID 도착시간 CPU버스트 우선순위 데드라인 주기 IO개수, 이어서 I/O 작업들
+void write_process_text(FILE *fp, Process *p) {
+    fprintf(fp, "%d %d %d %d %d %d %d\n", p->pid, p->arrival_time,
+            p->cpu_burst, p->priority, p->deadline, p->period,
+            p->io_count);
+
+    for (int j = 0; j < p->io_count; j++) {
+        fprintf(fp, "%d %d\n", p->io_operations[j].io_start,
+                p->io_operations[j].io_burst);
+    }
+}
+
+// 바이너리 형식으로 저장
+// I/O 테이블은 레코드 뒤에 오므로 임시 파일에 모았다가 이어 붙인다
+static int write_binary(WorkloadReader *reader, FILE *out) {
+    FILE *io_out = tmpfile();
+    if (io_out == NULL) {
+        perror("tmpfile");
+        return -1;
+    }
+
+    WorkloadHeader header;
+    memcpy(header.magic, WORKLOAD_MAGIC, 4);
+    header.version = WORKLOAD_VERSION;
+    header.process_count = (uint32_t)reader->declared_count;
+    header.io_count = 0;
+    fwrite(&header, sizeof(header), 1, out);
+
+    Process p;
+    int status;
+    while ((status = read_workload_process(reader, &p)) == 1) {
+        WorkloadRecord record;
+        record.pid = p.pid;
+        record.arrival_time = p.arrival_time;
+        record.cpu_burst = p.cpu_burst;
+        record.priority = p.priority;
+        record.deadline = p.deadline;
+        record.period = p.period;
+        record.io_offset = header.io_count;
+
+        record.io_count = (uint32_t)p.io_count;
+
+        for (int j = 0; j < p.io_count; j++) {
+            WorkloadIO io = {p.io_operations[j].io_start,
+                             p.io_operations[j].io_burst};
+            fwrite(&io, sizeof(io), 1, io_out);
+        }
+        header.io_count += record.io_count;
+        fwrite(&record, sizeof(record), 1, out);
+    }
+
+    if (status == 0) {
+        rewind(io_out);
+        char chunk[1 << 16];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), io_out)) > 0) {
+            fwrite(chunk, 1, n, out);
+        }
+
+        // 헤더에 I/O 개수 기록
+        fseek(out, 0, SEEK_SET);
+        fwrite(&header, sizeof(header), 1, out);
+    }
+
+    fclose(io_out);
+    return status;
+}
+
+// 워크로드 파일을 다른 형식으로 변환 (입력 형식은 자동 판별, 성공 0)
+// 같은 디렉터리에 만든 임시 파일에 쓴 뒤 성공했을 때만 out_path로 바꿔
+// 놓으므로 중간에 실패해도 잘린 파일이 남거나 기존 파일이 망가지지 않는다
+int convert_workload(const char *in_path, const char *out_path,
+                     WorkloadFormat format) {
+    WorkloadReader reader;
+    if (open_workload(&reader, in_path) != 0)
+        return -1;
+
+    size_t path_length = strlen(out_path) + sizeof(".XXXXXX");
+    char *temp_path = malloc(path_length);
+    if (temp_path == NULL) {
+        perror("convert");
+        exit(1);
+    }
+    snprintf(temp_path, path_length, "%s.XXXXXX", out_path);
+
+    // mkstemp는 0600으로 만드므로 fopen으로 만든 파일과 같은 권한으로 맞춤
+    int fd = mkstemp(temp_path);
+    FILE *out = NULL;
+    if (fd != -1) {
+        mode_t mask = umask(0);
+        umask(mask);
+        fchmod(fd, 0666 & ~mask);
+        out = fdopen(fd, format == WORKLOAD_BINARY ? "wb" : "w");
+    }
+    if (out == NULL) {
+        perror(out_path);
+        if (fd != -1) {
+            close(fd);
+            remove(temp_path);
+        }
+        free(temp_path);
+        close_workload(&reader);
+        return -1;
+    }
+
+    int status = 0;
+    if (format == WORKLOAD_BINARY) {
+        status = write_binary(&reader, out);
+    } else {
+        fprintf(out, "%d\n", reader.declared_count);
+
+        Process p;
+        while ((status = read_workload_process(&reader, &p)) == 1) {
+            write_process_text(out, &p);
+        }
+    }
+
+    if (ferror(out)) {
+        fprintf(stderr, "%s: write failed\n", out_path);
+        status = -1;
+    }
+    if (fclose(out) != 0 && status == 0) {
+        perror(out_path);
+        status = -1;
+    }
+    close_workload(&reader);
+
+    if (status == 0 && rename(temp_path, out_path) != 0) {
+        perror(out_path);
+        status = -1;
+    }
+    if (status != 0)
+        remove(temp_path);
+    free(temp_path);
+    return status;
+}